@@ -0,0 +1,92 @@
+#include "BitPlane.hpp"
+
+namespace halftone {
+
+// Constructor: All Pixels 0
+BitPlane::BitPlane(int rows, int cols) {
+    height = rows, width = cols, words = (cols + 63) / 64;
+    bits.assign((size_t)height * words, 0);
+}
+
+// Constructor: Pack a Binary Image
+BitPlane::BitPlane(const cv::Mat1f binImg) : BitPlane(binImg.rows, binImg.cols) {
+    for (int row = 0; row < height; row++) {
+        const float* binRow = binImg.ptr<float>(row);
+        uint64_t* bitRow = rowPtr(row);
+        for (int col = 0; col < width; col++)
+            if (binRow[col] > 0.5f) bitRow[col >> 6] |= 1ull << (col & 63);
+    }
+}
+
+// Unpack to a Binary Image
+cv::Mat1f BitPlane::toMat() const {
+    cv::Mat1f binImg(height, width);
+    for (int row = 0; row < height; row++) {
+        float* binRow = binImg.ptr<float>(row);
+        const uint64_t* bitRow = rowPtr(row);
+        for (int col = 0; col < width; col++) binRow[col] = (float)((bitRow[col >> 6] >> (col & 63)) & 1);
+    }
+    return binImg;
+}
+
+// Tone Statistics: Number of 1 Pixels
+size_t BitPlane::count() const {
+    size_t onCount = 0;  // Padding Bits are always 0
+    for (uint64_t word : bits) onCount += __builtin_popcountll(word);
+    return onCount;
+}
+
+// Tone Statistics: Number of 1 Pixels in a Region (Clipped to the Image)
+size_t BitPlane::count(cv::Rect roi) const {
+    roi &= cv::Rect(0, 0, width, height);
+    if (roi.width <= 0 || roi.height <= 0) return 0;
+
+    // 1. Word Range & the Masks of the partial First & Last Word
+    int wordSt = roi.x >> 6, wordEd = (roi.x + roi.width - 1) >> 6;
+    uint64_t maskSt = ~0ull << (roi.x & 63), maskEd = ~0ull >> (63 - ((roi.x + roi.width - 1) & 63));
+    if (wordSt == wordEd) maskSt &= maskEd;
+
+    // 2. Count the Masked Words of every Row
+    size_t onCount = 0;
+    for (int row = roi.y; row < roi.y + roi.height; row++) {
+        const uint64_t* bitRow = rowPtr(row);
+        onCount += __builtin_popcountll(bitRow[wordSt] & maskSt);
+        if (wordSt == wordEd) continue;
+        for (int wdx = wordSt + 1; wdx < wordEd; wdx++) onCount += __builtin_popcountll(bitRow[wdx]);
+        onCount += __builtin_popcountll(bitRow[wordEd] & maskEd);
+    }
+    return onCount;
+}
+
+// Tone Statistics: Ratio of 1 Pixels
+double BitPlane::tone() const {
+    return empty() ? 0.0 : (double)count() / ((double)height * width);
+}
+
+// Tone Statistics: Ratio of 1 Pixels in every Block (Edge Blocks are Clipped)
+cv::Mat1f BitPlane::toneMap(int blkSize) const {
+    cv::Mat1f toneImg((height + blkSize - 1) / blkSize, (width + blkSize - 1) / blkSize);
+    for (int row = 0; row < toneImg.rows; row++)
+        for (int col = 0; col < toneImg.cols; col++) {
+            cv::Rect blkRect = cv::Rect(col * blkSize, row * blkSize, blkSize, blkSize) & cv::Rect(0, 0, width, height);
+            toneImg(row, col) = (float)count(blkRect) / (float)blkRect.area();
+        }
+    return toneImg;
+}
+
+// Constructor: All Pixels 0 (Level 0)
+FrameBuffer::FrameBuffer(int rows, int cols, int bpp, bool msbFirst) {
+    height = rows, width = cols, depth = bpp, msbOrder = msbFirst, stride = (cols * bpp + 7) / 8;
+    bytes.assign((size_t)height * stride, 0);
+}
+
+// Unpack to a Gray Image
+cv::Mat1f FrameBuffer::toMat() const {
+    cv::Mat1f grayImg(height, width);
+    float maxLevel = (float)((1 << depth) - 1);
+    for (int row = 0; row < height; row++)
+        for (int col = 0; col < width; col++) grayImg(row, col) = get(row, col) / maxLevel;
+    return grayImg;
+}
+
+}  // namespace halftone
@@ -2,20 +2,31 @@
 
 namespace filter {
 
-// Convolution on Parallel Kernel
+int fftMinArea = 81;  // Direct Loop below 9 x 9, FFT from there on (Retune with BenchFFT)
+
+// Convolution on Parallel Kernel (Point Symmetric, K(d) = K(-d)): Visit Half of the Offsets, Add both Directions
 cv::Mat plConv(cv::Mat img, cv::Mat kernel) {
-    cv::Mat resImg = cv::Mat::zeros(img.rows, img.cols, CV_32F);
+    cv::Mat resImg;
+    plConv(img, kernel, resImg);
+    return resImg;
+}
+void plConv(const cv::Mat img, const cv::Mat kernel, cv::Mat& resImg) {
+    if (kernel.rows * kernel.cols >= fftMinArea) return fftConv(img, kernel, resImg, false);
+    resImg.create(img.rows, img.cols, CV_32F);
+    resImg.setTo(0);
     for (int row = 0; row < img.rows; row++)
-        for (int col = 0; col < img.cols; col++)
+        for (int col = 0; col < img.cols; col++) {
+            resImg.at<float>(row, col) += img.at<float>(row, col) * kernel.at<float>(kernel.rows / 2, kernel.cols / 2);
             for (int rdx = 0; rdx <= kernel.rows / 2; rdx++)
-                for (int cdx = 0; cdx <= kernel.cols / 2; cdx++) {
+                for (int cdx = -kernel.cols / 2; cdx <= kernel.cols / 2; cdx++) {
+                    if (rdx == 0 && cdx <= 0) continue;  // Center & the Mirrored Half
                     int nRow = row + rdx, nCol = col + cdx;
                     int kRow = rdx + kernel.rows / 2, kCol = cdx + kernel.cols / 2;
                     if (nRow < 0 || nRow >= img.rows || nCol < 0 || nCol >= img.cols) continue;
                     resImg.at<float>(nRow, nCol) += img.at<float>(row, col) * kernel.at<float>(kRow, kCol);
                     resImg.at<float>(row, col) += img.at<float>(nRow, nCol) * kernel.at<float>(kRow, kCol);
                 }
-    return resImg;
+        }
 }
 
 // Convolution on Normal Kernel
@@ -33,6 +44,94 @@ cv::Mat conv(cv::Mat img, cv::Mat kernel) {
     return resImg;
 }
 
+// Convolution with Periodic Boundary Condition
+cv::Mat pdConv(cv::Mat img, cv::Mat kernel) {
+    cv::Mat resImg;
+    pdConv(img, kernel, resImg);
+    return resImg;
+}
+void pdConv(const cv::Mat img, const cv::Mat kernel, cv::Mat& resImg) {
+    if (kernel.rows * kernel.cols >= fftMinArea) return fftConv(img, kernel, resImg, true);
+    int height = img.rows, width = img.cols;
+    resImg.create(height, width, CV_32F);
+    for (int row = 0; row < height; row++)
+        for (int col = 0; col < width; col++) {
+            float sumVal = 0;
+            for (int rdx = -kernel.rows / 2; rdx <= kernel.rows / 2; rdx++)
+                for (int cdx = -kernel.cols / 2; cdx <= kernel.cols / 2; cdx++) {
+                    int nRow = ((row + rdx) % height + height) % height, nCol = ((col + cdx) % width + width) % width;
+                    sumVal += kernel.at<float>(rdx + kernel.rows / 2, cdx + kernel.cols / 2) * img.at<float>(nRow, nCol);
+                }
+            resImg.at<float>(row, col) = sumVal;
+        }
+}
+
+// Convolution in the Frequency Domain: Spectrum of the Kernel, wrapped so the Kernel Center sits at (0, 0)
+static const cv::Mat& kernelSpec(const cv::Mat& kernel, cv::Size dftSize) {
+    struct KernelSpec {
+        cv::Mat kernel;    // Kernel the Spectrum was made from
+        cv::Size dftSize;  // Size of the Transform
+        cv::Mat spectrum;  // Forward Transform of the Wrapped Kernel
+    };
+    static thread_local std::vector<KernelSpec> specCache;  // Most recent Entry last
+    const int cacheSize = 4;
+
+    // 1. Look for the same Kernel (Values, not the Buffer) & Transform Size
+    for (size_t idx = 0; idx < specCache.size(); idx++) {
+        const KernelSpec& spec = specCache[idx];
+        if (spec.dftSize != dftSize || spec.kernel.size() != kernel.size()) continue;
+        bool same = true;
+        for (int row = 0; row < kernel.rows && same; row++)
+            same = std::memcmp(spec.kernel.ptr(row), kernel.ptr(row), kernel.cols * sizeof(float)) == 0;
+        if (!same) continue;
+        std::rotate(specCache.begin() + idx, specCache.begin() + idx + 1, specCache.end());
+        return specCache.back().spectrum;
+    }
+
+    // 2. Wrap the Kernel: Offset d lands on -d, so the Product of Spectrums correlates like conv (Kernels larger than the Transform fold up)
+    cv::Mat wrapImg = cv::Mat::zeros(dftSize, CV_32F);
+    for (int row = 0; row < kernel.rows; row++)
+        for (int col = 0; col < kernel.cols; col++) {
+            int wRow = ((kernel.rows / 2 - row) % dftSize.height + dftSize.height) % dftSize.height;
+            int wCol = ((kernel.cols / 2 - col) % dftSize.width + dftSize.width) % dftSize.width;
+            wrapImg.at<float>(wRow, wCol) += kernel.at<float>(row, col);
+        }
+
+    // 3. Transform & Cache, dropping the least recently used Entry
+    if ((int)specCache.size() == cacheSize) specCache.erase(specCache.begin());
+    KernelSpec spec = {kernel.clone(), dftSize, cv::Mat()};
+    cv::dft(wrapImg, spec.spectrum);
+    specCache.push_back(spec);
+    return specCache.back().spectrum;
+}
+
+// Convolution in the Frequency Domain (Periodic, or Zero-padded so the Wrap only hits the Padding)
+cv::Mat fftConv(cv::Mat img, cv::Mat kernel, bool periodic) {
+    cv::Mat resImg;
+    fftConv(img, kernel, resImg, periodic);
+    return resImg;
+}
+void fftConv(const cv::Mat img, const cv::Mat kernel, cv::Mat& resImg, bool periodic) {
+    static thread_local cv::Mat fltImg, fltKernel, padImg, specImg, fullImg;  // Workspace, kept while the Sizes repeat
+    int height = img.rows, width = img.cols;
+    cv::Mat srcImg = img, srcKernel = kernel;  // Headers only, converted when not Float
+    if (img.type() != CV_32F) img.convertTo(fltImg, CV_32F), srcImg = fltImg;
+    if (kernel.type() != CV_32F) kernel.convertTo(fltKernel, CV_32F), srcKernel = fltKernel;
+
+    // 1. Transform Size: the Image itself (Periodic), or enough Padding for the Kernel Reach on both Sides
+    cv::Size dftSize(width, height);
+    if (!periodic) {
+        dftSize = cv::Size(cv::getOptimalDFTSize(width + kernel.cols - 1), cv::getOptimalDFTSize(height + kernel.rows - 1));
+        cv::copyMakeBorder(srcImg, padImg, 0, dftSize.height - height, 0, dftSize.width - width, cv::BORDER_CONSTANT, cv::Scalar(0));
+    }
+
+    // 2. Multiply the Spectrums & Transform back (Rows past the Image are Zero in the Forward Transform)
+    cv::dft(periodic ? srcImg : padImg, specImg, 0, height);
+    cv::mulSpectrums(specImg, kernelSpec(srcKernel, dftSize), specImg, 0);
+    cv::dft(specImg, fullImg, cv::DFT_INVERSE | cv::DFT_SCALE | cv::DFT_REAL_OUTPUT);
+    fullImg(cv::Rect(0, 0, width, height)).copyTo(resImg);
+}
+
 cv::Mat gaussian(cv::Mat img, int kernelSize, float sigma) {
     cv::Mat resImg = img.clone();
     resImg.convertTo(resImg, CV_32F);
@@ -1,78 +1,67 @@
 #include "Halftone.hpp"
 
+#if defined(__SSE2__)
+#include <immintrin.h>
+#endif
+
 namespace halftone {
 
 std::string verbosePath = "DBS_verbose";  // Global Save Path for DBS Halftoning
 
-// Gaussian Kernel for Halftoning
-cv::Mat1f GSKernel;
-int GSKernelSize = 0;
-float GSSigma = 0;
+// Halftoning Context: the PSF & its Autocorrelation of the Job
+HalftoneContext::HalftoneContext(int kernelSize, float sigma) : kSize(kernelSize), sigma(sigma) {
+    psfMat = detail::getGSF(kernelSize, sigma);  // Gaussian PSF Kernel
+    cppMat = detail::getCPP(psfMat);             // PSF Autocorrelation
+}
 
 // Direct Binary Search (DBS) Halftoning
 cv::Mat1f DBS(const cv::Mat1f grayImg, cv::Mat1f initImg, int kernelSize, float sigma, int iters, bool verbose, std::string savePath) {
-    cv::Mat1f resImg = initImg.clone(), lsErrImg = initImg - grayImg;  // Result & Low-pass Error Image
-    cv::Mat1f psfMat = detail::getGSF(kernelSize, sigma);              // Gaussian PSF Kernel
+    HalftoneContext context(kernelSize, sigma);
+    return DBS(grayImg, initImg, context, iters, verbose, savePath);
+}
+cv::Mat1f DBS(const cv::Mat1f grayImg, cv::Mat1f initImg, HalftoneContext& context, int iters, bool verbose, std::string savePath) {
+    int kernelSize = context.kSize;
+    cv::Mat1f resImg = initImg.clone(), &lsErrImg = context.lsErrImg, &cpeImg = context.cpeImg;  // Result, Low-pass Error & c_pe
+    const cv::Mat1f psfMat = context.psfMat, cppMat = context.cppMat;                          // Gaussian PSF & Autocorrelation
     std::string workFolder = saveData::defFolder;
     int workAmount = iters * grayImg.rows * grayImg.cols, workCount = 0;  // Recording Work Progress
     int swapCount = 0, pixNum = grayImg.rows * grayImg.cols;              // Recording Swap Rate
     savePath = savePath.empty() ? verbosePath : savePath;                 // Set Save Path
 
-    // 1. Initialize Gaussian PSF Kernel & Low-pass Error Image
-    lsErrImg = filter::plConv(lsErrImg, psfMat);  // Low-pass Error Image
+    // 1. Initialize the Low-pass Error Image & c_pe Table in the Context
+    lsErrImg = filter::plConv(resImg - grayImg, psfMat);  // Low-pass Error Image
+    cpeImg = detail::getCPE(lsErrImg, psfMat);            // PSF & Low-pass Error Cross-correlation
+    double errSum = cv::sum(lsErrImg.mul(lsErrImg))[0];   // Total Squared Low-pass Error (DBS Objective)
     if (verbose) saveData::initVar(workFolder + "/" + savePath, "DBSlog");
     if (verbose) saveData::imgMat(resImg, "resImg_0"), saveData::imgMat(lsErrImg, "errImg_0");
+    if (verbose) saveData::logData("Iter 0 Error", (float)(errSum / pixNum));
 
     // 2. DBS Halftoning Iteration
     for (int iter = 0; iter < iters; iter++) {
         for (int row = 0; row < grayImg.rows; row++)
             for (int col = 0; col < grayImg.cols; col++) {
-                float minErr = 0;
-                cv::Vec2i minPos = {-1, -1};
-
                 if (verbose) {  // Show Progress
                     std::string title = "DBS Itr: " + std::to_string(iter + 1);
-                    std::string desc = "Swap Rate: " + std::to_string((int)((float)swapCount / (float)pixNum * 100)) + "%";
+                    std::string desc = "Swap Rate: " + std::to_string((int)((float)swapCount / (float)pixNum * 100)) + "%, Error: " + std::to_string(errSum / pixNum);
                     saveData::showProgress(title, (float)workCount / (float)workAmount, desc);
                 }
 
                 // For Every Pixel in the Kernel, Calculate whether to Swap/Toggle or Not by Min Error
-                for (int rdx = -1; rdx <= 1; rdx++)
-                    for (int cdx = -1; cdx <= 1; cdx++) {
-                        // Swap Condition
-                        int nRow = row + rdx, nCol = col + cdx;
-                        if (nRow < 0 || nRow >= grayImg.rows || nCol < 0 || nCol >= grayImg.cols) continue;
-                        if (resImg(nRow, nCol) == resImg(row, col)) continue;
-                        cv::Vec3i posCent = {row, col, (int)resImg(row, col) == 0 ? 1 : -1};
-                        cv::Vec3i posSwap = {nRow, nCol, (int)resImg(nRow, nCol) == 0 ? 1 : -1};
-                        float deltaErr = detail::deltaLpErr(lsErrImg, posCent, posSwap, kernelSize, psfMat);
-                        if (deltaErr < minErr) minErr = deltaErr, minPos = {nRow, nCol};
-                    }
-                // Toggle Condition
-                cv::Vec3i posCent = {row, col, (int)resImg(row, col) == 0 ? 1 : -1}, posSwap = {row, col, 0};
-                float deltaErr = detail::deltaLpErr(lsErrImg, posCent, posSwap, kernelSize, psfMat);
-                if (deltaErr < minErr) minErr = deltaErr, minPos = {row, col};
+                float minErr = 0;
+                cv::Vec2i minPos = {-1, -1};
+                std::tie(minErr, minPos) = detail::searchPix(resImg, lsErrImg, cpeImg, cppMat, {row, col}, kernelSize, psfMat);
 
                 workCount++;  // Update the Work Progress, Skip if No Swap/Toggle
                 if (minPos[0] == -1 || minPos[1] == -1) continue;
 
-                // Update the Result Image & Low-pass Error Image
-                cv::Vec3i newCent = {row, col, (int)resImg(row, col) == 0 ? 1 : -1};
-                cv::Vec3i newSwap = {minPos[0], minPos[1], (int)resImg(minPos[0], minPos[1]) == 0 ? 1 : -1};
-                if (newCent[0] == newSwap[0] && newCent[1] == newSwap[1]) newSwap[2] = 0;
-                resImg(newCent[0], newCent[1]) += newCent[2], resImg(newSwap[0], newSwap[1]) += newSwap[2];
-                lsErrImg = detail::altLpErr(lsErrImg, newCent, kernelSize, psfMat);
-                lsErrImg = detail::altLpErr(lsErrImg, newSwap, kernelSize, psfMat);
-                swapCount++;  // Update the Swap Rate & Work Progress
+                // Update the Result Image, Low-pass Error Image & Cross-correlation Image
+                detail::applySwap(resImg, lsErrImg, cpeImg, cppMat, {row, col}, minPos, kernelSize, psfMat);
+                swapCount++, errSum += minErr;  // Update the Swap Rate, Work Progress & Total Error
             }
         // Verbose Show the Result of Each Iteration
         if (verbose) saveData::imgMat(resImg, "resImg_" + std::to_string(iter + 1)), saveData::imgMat(lsErrImg, "errImg_" + std::to_string(iter + 1));
-        // Verbose Save log for Each Iteration
-        float errVal = 0;
-        for (int row = 0; row < grayImg.rows; row++)
-            for (int col = 0; col < grayImg.cols; col++) errVal += std::abs(lsErrImg(row, col));
-        errVal /= (float)(grayImg.rows * grayImg.cols);
-        if (verbose) saveData::logData("Iter " + std::to_string(iter + 1) + " Error", errVal);
+        // Verbose Save log for Each Iteration (Error is tracked by the accepted Delta Errors, no Rescan)
+        if (verbose) saveData::logData("Iter " + std::to_string(iter + 1) + " Error", (float)(errSum / pixNum));
         if (verbose) saveData::logData("Iter " + std::to_string(iter + 1) + " Swap Rate", (float)swapCount / (float)pixNum * 100.0f);
         swapCount = 0;  // Reset the Swap Rate
     }
@@ -82,78 +71,342 @@ cv::Mat1f DBS(const cv::Mat1f grayImg, cv::Mat1f initImg, int kernelSize, float
 cv::Mat1f DBS(const cv::Mat1f grayImg, int kernelSize, float sigma, int iters, bool verbose, std::string savePath) {
     return DBS(grayImg, getRandBin(cv::Vec2i(grayImg.rows, grayImg.cols)), kernelSize, sigma, iters, verbose, savePath);
 }
+void DBS(const cv::Mat1f grayImg, BitPlane& resBin, int kernelSize, float sigma, int iters, bool verbose, std::string savePath) {
+    if (resBin.rows() != grayImg.rows || resBin.cols() != grayImg.cols) resBin = BitPlane(grayImg.rows, grayImg.cols), getRandBin(resBin);
+    resBin = BitPlane(DBS(grayImg, resBin.toMat(), kernelSize, sigma, iters, verbose, savePath));
+}
+
+// Active-set Direct Binary Search (A-DBS) Halftoning
+cv::Mat1f ADBS(const cv::Mat1f grayImg, cv::Mat1f initImg, int kernelSize, float sigma, int maxIters, bool verbose, std::string savePath) {
+    cv::Mat1f resImg = initImg.clone(), lsErrImg = initImg - grayImg;  // Result & Low-pass Error Image
+    cv::Mat1f psfMat = detail::getGSF(kernelSize, sigma);              // Gaussian PSF Kernel
+    cv::Mat1b curActive(grayImg.size(), 1), nextActive(grayImg.size(), 0);  // Active Pixels of this & next Iteration
+    std::string workFolder = saveData::defFolder;
+    int activeCount = grayImg.rows * grayImg.cols, visitCount = 0;  // Recording Active Pixels (Visited ones may exceed it)
+    int swapCount = 0, pixNum = grayImg.rows * grayImg.cols;        // Recording Swap Rate
+    savePath = savePath.empty() ? verbosePath : savePath;           // Set Save Path
+
+    // 1. Initialize Gaussian PSF Kernel, Low-pass Error Image & PSF Correlation Tables
+    lsErrImg = filter::plConv(lsErrImg, psfMat);          // Low-pass Error Image
+    cv::Mat1f cppMat = detail::getCPP(psfMat);            // PSF Autocorrelation
+    cv::Mat1f cpeImg = detail::getCPE(lsErrImg, psfMat);  // PSF & Low-pass Error Cross-correlation
+    double errSum = cv::sum(lsErrImg.mul(lsErrImg))[0];   // Total Squared Low-pass Error (DBS Objective)
+    if (verbose) saveData::initVar(workFolder + "/" + savePath, "DBSlog");
+    if (verbose) saveData::imgMat(resImg, "resImg_0"), saveData::imgMat(lsErrImg, "errImg_0");
+    if (verbose) saveData::logData("Iter 0 Error", (float)(errSum / pixNum));
+
+    // 2. DBS Halftoning Iteration, only Visit Pixels whose Neighborhood changed in the last Pass
+    for (int iter = 0; iter < maxIters && activeCount > 0; iter++) {
+        for (int row = 0; row < grayImg.rows; row++) {
+            uchar* activeRow = curActive.ptr<uchar>(row);
+            for (int col = 0; col < grayImg.cols; col++) {
+                if (!activeRow[col]) continue;
+                activeRow[col] = 0, visitCount++;
+
+                if (verbose) {  // Show Progress
+                    std::string title = "A-DBS Itr: " + std::to_string(iter + 1);
+                    std::string desc = "Swap Rate: " + std::to_string((int)((float)swapCount / (float)pixNum * 100)) + "%, Error: " + std::to_string(errSum / pixNum);
+                    saveData::showProgress(title, std::min(1.0f, (float)visitCount / (float)activeCount), desc);
+                }
+
+                // For Every Pixel in the Kernel, Calculate whether to Swap/Toggle or Not by Min Error
+                float minErr = 0;
+                cv::Vec2i minPos = {-1, -1};
+                std::tie(minErr, minPos) = detail::searchPix(resImg, lsErrImg, cpeImg, cppMat, {row, col}, kernelSize, psfMat);
+                if (minPos[0] == -1 || minPos[1] == -1) continue;
+
+                // Update the Result Image, Low-pass Error Image & Cross-correlation Image
+                detail::applySwap(resImg, lsErrImg, cpeImg, cppMat, {row, col}, minPos, kernelSize, psfMat);
+                detail::markActive(curActive, nextActive, {row, col}, {row, col}, kernelSize);
+                detail::markActive(curActive, nextActive, minPos, {row, col}, kernelSize);
+                swapCount++, errSum += minErr;  // Update the Swap Rate & Total Error
+            }
+        }
+        // Verbose Show the Result of Each Iteration
+        if (verbose) saveData::imgMat(resImg, "resImg_" + std::to_string(iter + 1)), saveData::imgMat(lsErrImg, "errImg_" + std::to_string(iter + 1));
+        // Verbose Save log for Each Iteration (Error is tracked by the accepted Delta Errors, no Rescan)
+        if (verbose) saveData::logData("Iter " + std::to_string(iter + 1) + " Error", (float)(errSum / pixNum));
+        if (verbose) saveData::logData("Iter " + std::to_string(iter + 1) + " Swap Rate", (float)swapCount / (float)pixNum * 100.0f);
+        if (verbose) saveData::logData("Iter " + std::to_string(iter + 1) + " Active Rate", (float)activeCount / (float)pixNum * 100.0f);
+
+        // Swap the Active Set for the next Iteration
+        std::swap(curActive, nextActive);
+        activeCount = cv::countNonZero(curActive), visitCount = 0, swapCount = 0;
+    }
+    if (verbose) saveData::initVar(workFolder);
+    return resImg;
+}
+cv::Mat1f ADBS(const cv::Mat1f grayImg, int kernelSize, float sigma, int maxIters, bool verbose, std::string savePath) {
+    return ADBS(grayImg, getRandBin(cv::Vec2i(grayImg.rows, grayImg.cols)), kernelSize, sigma, maxIters, verbose, savePath);
+}
+
+// Direct Binary Search (MR-DBS) Halftoning from an Error Diffusion Start
+cv::Mat1f MRDBS(const cv::Mat1f grayImg, int kernelSize, float sigma, int iters, bool verbose, std::string savePath) {
+    cv::Mat1f initImg = ErrDiff(grayImg, 3);  // Floyd-Steinberg Start, already below the Error of a long random-start DBS
+    return ADBS(grayImg, initImg, kernelSize, sigma, iters, verbose, savePath);
+}
+
+// Parallel Tiled Direct Binary Search (P-DBS) Halftoning
+cv::Mat1f PDBS(const cv::Mat1f grayImg, cv::Mat1f initImg, int kernelSize, float sigma, int iters, int threads, bool verbose, std::string savePath) {
+    cv::Mat1f resImg = initImg.clone(), lsErrImg = initImg - grayImg;  // Result & Low-pass Error Image
+    cv::Mat1f psfMat = detail::getGSF(kernelSize, sigma);              // Gaussian PSF Kernel
+    std::string workFolder = saveData::defFolder;
+    int tileSize = 2 * kernelSize + 2;  // Same Color Tiles are one Tile apart, wider than the Write Reach (K) + Read Reach (K/2 + 2)
+    int tileRows = (grayImg.rows + tileSize - 1) / tileSize, tileCols = (grayImg.cols + tileSize - 1) / tileSize;
+    int workAmount = iters * 4, workCount = 0;                // Recording Work Progress (by Phase)
+    int swapCount = 0, pixNum = grayImg.rows * grayImg.cols;  // Recording Swap Rate
+    double nStripes = threads > 0 ? threads : -1;             // Stripes per Phase (the global Thread Number is left as is)
+    savePath = savePath.empty() ? verbosePath : savePath;     // Set Save Path
+
+    // 1. Initialize Gaussian PSF Kernel, Low-pass Error Image & PSF Correlation Tables
+    lsErrImg = filter::plConv(lsErrImg, psfMat);          // Low-pass Error Image
+    cv::Mat1f cppMat = detail::getCPP(psfMat);            // PSF Autocorrelation
+    cv::Mat1f cpeImg = detail::getCPE(lsErrImg, psfMat);  // PSF & Low-pass Error Cross-correlation
+    double errSum = cv::sum(lsErrImg.mul(lsErrImg))[0];   // Total Squared Low-pass Error (DBS Objective)
+    if (verbose) saveData::initVar(workFolder + "/" + savePath, "DBSlog");
+    if (verbose) saveData::imgMat(resImg, "resImg_0"), saveData::imgMat(lsErrImg, "errImg_0");
+    if (verbose) saveData::logData("Iter 0 Error", (float)(errSum / pixNum));
+
+    // 2. DBS Halftoning Iteration, 4-Color Tile Schedule (Tiles of the same Color never interact)
+    for (int iter = 0; iter < iters; iter++) {
+        for (int phase = 0; phase < 4; phase++) {
+            int phRow = phase / 2, phCol = phase % 2;
+            int phTileRows = (tileRows - phRow + 1) / 2, phTileCols = (tileCols - phCol + 1) / 2;
+            std::vector<int> tileSwap(phTileRows * phTileCols, 0);
+            std::vector<double> tileErr(phTileRows * phTileCols, 0);
+
+            cv::parallel_for_(cv::Range(0, phTileRows * phTileCols), [&](const cv::Range& range) {
+                for (int idx = range.start; idx < range.end; idx++) {
+                    int tRow = (idx / phTileCols) * 2 + phRow, tCol = (idx % phTileCols) * 2 + phCol;
+                    int rowEd = std::min((tRow + 1) * tileSize, grayImg.rows), colEd = std::min((tCol + 1) * tileSize, grayImg.cols);
+                    for (int row = tRow * tileSize; row < rowEd; row++)
+                        for (int col = tCol * tileSize; col < colEd; col++) {
+                            // For Every Pixel in the Kernel, Calculate whether to Swap/Toggle or Not by Min Error
+                            float minErr = 0;
+                            cv::Vec2i minPos = {-1, -1};
+                            std::tie(minErr, minPos) = detail::searchPix(resImg, lsErrImg, cpeImg, cppMat, {row, col}, kernelSize, psfMat);
+                            if (minPos[0] == -1 || minPos[1] == -1) continue;
+
+                            // Update the Result Image, Low-pass Error Image & Cross-correlation Image
+                            detail::applySwap(resImg, lsErrImg, cpeImg, cppMat, {row, col}, minPos, kernelSize, psfMat);
+                            tileSwap[idx]++, tileErr[idx] += minErr;  // Update the Swap Rate & Delta Error of the Tile
+                        }
+                }
+            }, nStripes);  // Barrier: every Tile of this Color is done before the next Phase
+            for (int idx = 0; idx < tileSwap.size(); idx++) swapCount += tileSwap[idx], errSum += tileErr[idx];
+
+            if (verbose) {  // Show Progress
+                std::string title = "P-DBS Itr: " + std::to_string(iter + 1);
+                std::string desc = "Swap Rate: " + std::to_string((int)((float)swapCount / (float)pixNum * 100)) + "%, Error: " + std::to_string(errSum / pixNum);
+                saveData::showProgress(title, (float)++workCount / (float)workAmount, desc);
+            }
+        }
+        // Verbose Show the Result of Each Iteration
+        if (verbose) saveData::imgMat(resImg, "resImg_" + std::to_string(iter + 1)), saveData::imgMat(lsErrImg, "errImg_" + std::to_string(iter + 1));
+        // Verbose Save log for Each Iteration (Error is tracked by the accepted Delta Errors, no Rescan)
+        if (verbose) saveData::logData("Iter " + std::to_string(iter + 1) + " Error", (float)(errSum / pixNum));
+        if (verbose) saveData::logData("Iter " + std::to_string(iter + 1) + " Swap Rate", (float)swapCount / (float)pixNum * 100.0f);
+        swapCount = 0;  // Reset the Swap Rate
+    }
+    if (verbose) saveData::initVar(workFolder);
+    return resImg;
+}
+cv::Mat1f PDBS(const cv::Mat1f grayImg, int kernelSize, float sigma, int iters, int threads, bool verbose, std::string savePath) {
+    return PDBS(grayImg, getRandBin(cv::Vec2i(grayImg.rows, grayImg.cols)), kernelSize, sigma, iters, threads, verbose, savePath);
+}
+
+// Time-budgeted Direct Binary Search (T-DBS) Halftoning
+TDBSResult TDBS(const cv::Mat1f grayImg, float deadlineMs, float targetErr, int kernelSize, float sigma, bool verbose, std::string savePath) {
+    auto stTime = std::chrono::steady_clock::now();
+    auto isTimeUp = [&]() { return std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - stTime).count() >= deadlineMs; };
+    TDBSResult result;
+    cv::Mat1f resImg = ErrDiff(grayImg, 3), lsErrImg = resImg - grayImg;  // Result (Fast Start) & Low-pass Error Image
+    cv::Mat1f psfMat = detail::getGSF(kernelSize, sigma);                  // Gaussian PSF Kernel
+    std::string workFolder = saveData::defFolder;
+    int tileSize = 2 * kernelSize + 2;  // Tile Size for Work Ordering
+    int tileRows = (grayImg.rows + tileSize - 1) / tileSize, tileCols = (grayImg.cols + tileSize - 1) / tileSize;
+    int swapCount = 0, pixNum = grayImg.rows * grayImg.cols;  // Recording Swap Rate
+    savePath = savePath.empty() ? verbosePath : savePath;     // Set Save Path
+
+    // 1. Initialize Gaussian PSF Kernel, Low-pass Error Image & PSF Correlation Tables
+    lsErrImg = filter::plConv(lsErrImg, psfMat);          // Low-pass Error Image
+    cv::Mat1f cppMat = detail::getCPP(psfMat);            // PSF Autocorrelation
+    cv::Mat1f cpeImg = detail::getCPE(lsErrImg, psfMat);  // PSF & Low-pass Error Cross-correlation
+    double errSum = cv::sum(lsErrImg.mul(lsErrImg))[0];   // Total Squared Low-pass Error (DBS Objective)
+    if (verbose) saveData::initVar(workFolder + "/" + savePath, "DBSlog");
+    if (verbose) saveData::logData("Iter 0 Error", (float)(errSum / pixNum));
+
+    // 2. DBS Halftoning Iteration until the Deadline, Target Error or Convergence
+    bool isDone = errSum / pixNum <= targetErr || isTimeUp();
+    while (!isDone) {
+        // Order the Tiles by their Low-pass Error Energy, largest First
+        std::vector<std::pair<double, cv::Vec2i>> tileSeq;
+        for (int tRow = 0; tRow < tileRows; tRow++)
+            for (int tCol = 0; tCol < tileCols; tCol++) {
+                cv::Rect tileRect(tCol * tileSize, tRow * tileSize, tileSize, tileSize);
+                cv::Mat1f tileErr = lsErrImg(tileRect & cv::Rect(0, 0, grayImg.cols, grayImg.rows));
+                tileSeq.push_back({cv::sum(tileErr.mul(tileErr))[0], {tRow, tCol}});
+            }
+        std::sort(tileSeq.begin(), tileSeq.end(), [](const auto& lhs, const auto& rhs) { return lhs.first > rhs.first; });
+
+        for (int idx = 0; idx < tileSeq.size() && !isDone; idx++) {
+            int tRow = tileSeq[idx].second[0], tCol = tileSeq[idx].second[1];
+            int rowEd = std::min((tRow + 1) * tileSize, grayImg.rows), colEd = std::min((tCol + 1) * tileSize, grayImg.cols);
+            for (int row = tRow * tileSize; row < rowEd; row++)
+                for (int col = tCol * tileSize; col < colEd; col++) {
+                    // For Every Pixel in the Kernel, Calculate whether to Swap/Toggle or Not by Min Error
+                    float minErr = 0;
+                    cv::Vec2i minPos = {-1, -1};
+                    std::tie(minErr, minPos) = detail::searchPix(resImg, lsErrImg, cpeImg, cppMat, {row, col}, kernelSize, psfMat);
+                    if (minPos[0] == -1 || minPos[1] == -1) continue;
+
+                    // Update the Result Image, Low-pass Error Image & Cross-correlation Image
+                    detail::applySwap(resImg, lsErrImg, cpeImg, cppMat, {row, col}, minPos, kernelSize, psfMat);
+                    swapCount++, errSum += minErr;  // Update the Swap Rate & Total Error
+                }
+            isDone = errSum / pixNum <= targetErr || isTimeUp();  // Check the Budget after every Tile
+        }
+        result.iters++;
+
+        // Verbose Save log for Each Iteration, Stop if no Swap/Toggle is left
+        if (verbose) saveData::logData("Iter " + std::to_string(result.iters) + " Error", (float)(errSum / pixNum));
+        if (verbose) saveData::logData("Iter " + std::to_string(result.iters) + " Swap Rate", (float)swapCount / (float)pixNum * 100.0f);
+        isDone = isDone || swapCount == 0, swapCount = 0;
+    }
+    if (verbose) saveData::initVar(workFolder);
+    result.resImg = resImg, result.errVal = errSum / pixNum;
+    return result;
+}
+
+// Color Direct Binary Search (C-DBS) Halftoning
+cv::Mat3f CDBS(const cv::Mat3f colorImg, cv::Mat3f initImg, int kernelSize, float sigma, int iters, bool perceptual, bool verbose, std::string savePath) {
+    int height = colorImg.rows, width = colorImg.cols, half = kernelSize / 2;
+    cv::Mat3f resImg = initImg.clone(), lsErrImg, cpeImg;                            // Result, Low-pass Error (Opponent Space) & c_pe per BGR Channel
+    cv::Mat1f psfMat = detail::getGSF(kernelSize, sigma);                            // Gaussian PSF Kernel
+    cv::Mat1f oppMat = detail::getOppMat(perceptual), wgtMat = oppMat.t() * oppMat;  // Opponent Space Matrix T & T^T T
+    std::string workFolder = saveData::defFolder;
+    int workAmount = iters * height * width, workCount = 0;  // Recording Work Progress
+    int swapCount = 0, pixNum = height * width;              // Recording Swap Rate
+    savePath = savePath.empty() ? verbosePath : savePath;    // Set Save Path
+
+    // 1. Initialize the pixel-interleaved Low-pass Error & c_pe Images, and the PSF Autocorrelation
+    std::vector<cv::Mat> errChs = colorconvert::splitCh(initImg - colorImg), cpeChs;
+    for (cv::Mat& errCh : errChs) errCh = filter::plConv(errCh, psfMat);
+    cv::transform(colorconvert::mergeCh(errChs), lsErrImg, oppMat);  // Low-pass Error in the Opponent Space
+    for (cv::Mat& oppCh : colorconvert::splitCh(lsErrImg)) cpeChs.push_back(detail::getCPE(oppCh, psfMat));
+    cv::transform(colorconvert::mergeCh(cpeChs), cpeImg, oppMat.t());  // Cross-correlation seen by each BGR Channel
+    cv::Mat1f cppMat = detail::getCPP(psfMat);                           // PSF Autocorrelation
+    std::vector<cv::Mat3f> lpKers = detail::getChKers(psfMat, oppMat);   // PSF of each Channel on the Opponent Planes
+    std::vector<cv::Mat3f> cpeKers = detail::getChKers(cppMat, wgtMat);  // c_pp of each Channel on the c_pe Lanes
+    double errSum = cv::norm(lsErrImg, cv::NORM_L2SQR);                  // Total Squared Low-pass Error (C-DBS Objective)
+    if (verbose) saveData::initVar(workFolder + "/" + savePath, "DBSlog");
+    if (verbose) saveData::imgMat(initImg, "resImg_0"), saveData::imgMat(lsErrImg, "errImg_0");
+    if (verbose) saveData::logData("Iter 0 Error", (float)(errSum / pixNum));
+
+    // 2. C-DBS Halftoning Iteration, all Channels of a Pixel are searched in the same Visit
+    for (int iter = 0; iter < iters; iter++) {
+        for (int row = 0; row < height; row++)
+            for (int col = 0; col < width; col++) {
+                if (verbose) {  // Show Progress
+                    std::string title = "C-DBS Itr: " + std::to_string(iter + 1);
+                    std::string desc = "Swap Rate: " + std::to_string((int)((float)swapCount / (float)(3 * pixNum) * 100)) + "%, Error: " + std::to_string(errSum / pixNum);
+                    saveData::showProgress(title, (float)workCount / (float)workAmount, desc);
+                }
+
+                // For Every Pixel in the Kernel, Calculate the Swap/Toggle of all Channels at once, one Channel after the other near the Border
+                bool isJoint = row > half && row < height - 1 - half && col > half && col < width - 1 - half;
+                for (int ch = 0; ch < (isJoint ? 1 : 3); ch++) {
+                    float minErr = 0;
+                    cv::Vec3i minIdx;
+                    std::tie(minErr, minIdx) = isJoint ? detail::searchPixInner(resImg, cpeImg, cppMat, {row, col}, wgtMat)
+                                                       : detail::searchPix(resImg, lsErrImg, cpeImg, cppMat, {row, col}, ch, kernelSize, psfMat, oppMat);
+                    if (minIdx == cv::Vec3i(-1, -1, -1)) continue;
+
+                    // Update the Result, Low-pass Error & Cross-correlation Images
+                    detail::applySwap(resImg, lsErrImg, cpeImg, {row, col}, minIdx, lpKers, cpeKers);
+                    swapCount += (minIdx[0] != -1) + (minIdx[1] != -1) + (minIdx[2] != -1), errSum += minErr;  // Update the Swap Rate & Total Error
+                }
+                workCount++;  // Update the Work Progress
+            }
+        // Verbose Show the Result of Each Iteration
+        if (verbose) saveData::imgMat(resImg, "resImg_" + std::to_string(iter + 1));
+        if (verbose) saveData::imgMat(lsErrImg, "errImg_" + std::to_string(iter + 1));
+        // Verbose Save log for Each Iteration (Error is tracked by the accepted Delta Errors, no Rescan)
+        if (verbose) saveData::logData("Iter " + std::to_string(iter + 1) + " Error", (float)(errSum / pixNum));
+        if (verbose) saveData::logData("Iter " + std::to_string(iter + 1) + " Swap Rate", (float)swapCount / (float)(3 * pixNum) * 100.0f);
+        swapCount = 0;  // Reset the Swap Rate
+    }
+    if (verbose) saveData::initVar(workFolder);
+    return resImg;
+}
+cv::Mat3f CDBS(const cv::Mat3f colorImg, int kernelSize, float sigma, int iters, bool perceptual, bool verbose, std::string savePath) {
+    cv::Vec2i imgSize = {colorImg.rows, colorImg.cols};
+    cv::Mat3f initImg = colorconvert::mergeCh({getRandBin(imgSize), getRandBin(imgSize), getRandBin(imgSize)});
+    return CDBS(colorImg, initImg, kernelSize, sigma, iters, perceptual, verbose, savePath);
+}
 
 // Random Tiled Blocks Direct Binary Search (RTB-DBS) Halftoning
 cv::Mat1f RTBDBS(const cv::Mat1f grayImg, cv::Mat1f initImg, cv::Mat1i blkMap, int kernelSize, float sigma, int iters, bool verbose, std::string savePath) {
-    cv::Mat1f resImg = initImg.clone(), lsErrImg = initImg - grayImg;  // Result & Low-pass Error Image
+    HalftoneContext context(kernelSize, sigma);
+    return RTBDBS(grayImg, initImg, blkMap, context, iters, verbose, savePath);
+}
+cv::Mat1f RTBDBS(const cv::Mat1f grayImg, cv::Mat1f initImg, cv::Mat1i blkMap, HalftoneContext& context, int iters, bool verbose, std::string savePath) {
+    if (blkMap.empty()) {  // e.g. getVCMask with a Block Size out of Range
+        std::cerr << "Block Map of RTB-DBS is empty!" << std::endl;
+        return cv::Mat1f();
+    }
+    int kernelSize = context.kSize;
+    cv::Mat1f resImg = initImg.clone(), &lsErrImg = context.lsErrImg, &cpeImg = context.cpeImg;  // Result, Low-pass Error & c_pe
+    const cv::Mat1f psfMat = context.psfMat, cppMat = context.cppMat;                          // Gaussian PSF & Autocorrelation
     std::string workFolder = saveData::defFolder;
     int workAmount = iters * grayImg.rows * grayImg.cols, workCount = 0;  // Recording Work Progress
     int swapCount = 0, pixNum = grayImg.rows * grayImg.cols;              // Recording Swap Rate
     savePath = savePath.empty() ? verbosePath : savePath;                 // Set Save Path
+    int blkRows = (grayImg.rows + blkMap.rows - 1) / blkMap.rows;         // Block Rows (incl. a Partial one)
+    int blkCols = (grayImg.cols + blkMap.cols - 1) / blkMap.cols;         // Block Columns (incl. a Partial one)
 
     // 1. Generate Process Sequence by Block Map
     std::vector<cv::Vec2i> blkSeq(blkMap.rows * blkMap.cols);
     for (int row = 0; row < blkMap.rows; row++)
         for (int col = 0; col < blkMap.cols; col++) blkSeq[blkMap(row, col)] = {row, col};
 
-    // 2. Initialize Gaussian PSF Kernel & Low-pass Error Image
-    cv::Mat1f psfMat = detail::getGSF(kernelSize, sigma);  // Gaussian PSF Kernel
-    lsErrImg = filter::plConv(lsErrImg, psfMat);           // Low-pass Error Image
+    // 2. Initialize the Low-pass Error Image & c_pe Table in the Context
+    lsErrImg = filter::plConv(resImg - grayImg, psfMat);  // Low-pass Error Image
+    cpeImg = detail::getCPE(lsErrImg, psfMat);            // PSF & Low-pass Error Cross-correlation
+    double errSum = cv::sum(lsErrImg.mul(lsErrImg))[0];   // Total Squared Low-pass Error (DBS Objective)
     if (verbose) saveData::initVar(workFolder + "/" + savePath, "DBSlog");
     if (verbose) saveData::imgMat(resImg, "resImg_0"), saveData::imgMat(lsErrImg, "errImg_0");
+    if (verbose) saveData::logData("Iter 0 Error", (float)(errSum / pixNum));
 
-    // 3. DBS Halftoning Iteration
+    // 3. DBS Halftoning Iteration (Partial Blocks at the Bottom & Right Edge skip the Positions outside the Image)
     for (int iter = 0; iter < iters; iter++) {
-        for (int blkR = 0; blkR < grayImg.rows / blkMap.rows; blkR++)
-            for (int blkC = 0; blkC < grayImg.cols / blkMap.cols; blkC++)
+        for (int blkR = 0; blkR < blkRows; blkR++)
+            for (int blkC = 0; blkC < blkCols; blkC++)
                 for (cv::Vec2i workPos : blkSeq) {
                     int row = blkR * blkMap.rows + workPos[0], col = blkC * blkMap.cols + workPos[1];
-                    float minErr = 0;
-                    cv::Vec2i minPos = {-1, -1};
-
+                    if (row >= grayImg.rows || col >= grayImg.cols) continue;
                     if (verbose) {  // Show Progress
                         std::string title = "DBS Itr: " + std::to_string(iter + 1);
-                        std::string desc = "Swap Rate: " + std::to_string((int)((float)swapCount / (float)pixNum * 100)) + "%";
+                        std::string desc = "Swap Rate: " + std::to_string((int)((float)swapCount / (float)pixNum * 100)) + "%, Error: " + std::to_string(errSum / pixNum);
                         saveData::showProgress(title, (float)workCount / (float)workAmount, desc);
                     }
 
                     // For Every Pixel in the Kernel, Calculate whether to Swap/Toggle or Not by Min Error
-                    for (int rdx = -1; rdx <= 1; rdx++)
-                        for (int cdx = -1; cdx <= 1; cdx++) {
-                            // Swap Condition
-                            int nRow = row + rdx, nCol = col + cdx;
-                            if (nRow < 0 || nRow >= grayImg.rows || nCol < 0 || nCol >= grayImg.cols) continue;
-                            if (resImg(nRow, nCol) == resImg(row, col)) continue;
-                            cv::Vec3i posCent = {row, col, (int)resImg(row, col) == 0 ? 1 : -1};
-                            cv::Vec3i posSwap = {nRow, nCol, (int)resImg(nRow, nCol) == 0 ? 1 : -1};
-                            float deltaErr = detail::deltaLpErr(lsErrImg, posCent, posSwap, kernelSize, psfMat);
-                            if (deltaErr < minErr) minErr = deltaErr, minPos = {nRow, nCol};
-                        }
-                    // Toggle Condition
-                    cv::Vec3i posCent = {row, col, (int)resImg(row, col) == 0 ? 1 : -1}, posSwap = {row, col, 0};
-                    float deltaErr = detail::deltaLpErr(lsErrImg, posCent, posSwap, kernelSize, psfMat);
-                    if (deltaErr < minErr) minErr = deltaErr, minPos = {row, col};
+                    float minErr = 0;
+                    cv::Vec2i minPos = {-1, -1};
+                    std::tie(minErr, minPos) = detail::searchPix(resImg, lsErrImg, cpeImg, cppMat, {row, col}, kernelSize, psfMat);
 
                     workCount++;  // Update the Work Progress, Skip if No Swap/Toggle
                     if (minPos[0] == -1 || minPos[1] == -1) continue;
 
-                    // Update the Result Image & Low-pass Error Image
-                    cv::Vec3i newCent = {row, col, (int)resImg(row, col) == 0 ? 1 : -1};
-                    cv::Vec3i newSwap = {minPos[0], minPos[1], (int)resImg(minPos[0], minPos[1]) == 0 ? 1 : -1};
-                    if (newCent[0] == newSwap[0] && newCent[1] == newSwap[1]) newSwap[2] = 0;
-                    resImg(newCent[0], newCent[1]) += newCent[2], resImg(newSwap[0], newSwap[1]) += newSwap[2];
-                    lsErrImg = detail::altLpErr(lsErrImg, newCent, kernelSize, psfMat);
-                    lsErrImg = detail::altLpErr(lsErrImg, newSwap, kernelSize, psfMat);
-                    swapCount++;  // Update the Swap Rate & Work Progress
+                    // Update the Result Image, Low-pass Error Image & Cross-correlation Image
+                    detail::applySwap(resImg, lsErrImg, cpeImg, cppMat, {row, col}, minPos, kernelSize, psfMat);
+                    swapCount++, errSum += minErr;  // Update the Swap Rate, Work Progress & Total Error
                 }
         // Verbose Show the Result of Each Iteration
         if (verbose) saveData::imgMat(resImg, "resImg_" + std::to_string(iter + 1)), saveData::imgMat(lsErrImg, "errImg_" + std::to_string(iter + 1));
-        // Verbose Save log for Each Iteration
-        float errVal = 0;
-        for (int row = 0; row < grayImg.rows; row++)
-            for (int col = 0; col < grayImg.cols; col++) errVal += std::abs(lsErrImg(row, col));
-        errVal /= (float)(grayImg.rows * grayImg.cols);
-        if (verbose) saveData::logData("Iter " + std::to_string(iter + 1) + " Error", errVal);
+        // Verbose Save log for Each Iteration (Error is tracked by the accepted Delta Errors, no Rescan)
+        if (verbose) saveData::logData("Iter " + std::to_string(iter + 1) + " Error", (float)(errSum / pixNum));
         if (verbose) saveData::logData("Iter " + std::to_string(iter + 1) + " Swap Rate", (float)swapCount / (float)pixNum * 100.0f);
         swapCount = 0;  // Reset the Swap Rate
     }
@@ -164,95 +417,272 @@ cv::Mat1f RTBDBS(const cv::Mat1f grayImg, cv::Mat1i blkMap, int kernelSize, floa
     return RTBDBS(grayImg, getRandBin(cv::Vec2i(grayImg.rows, grayImg.cols)), blkMap, kernelSize, sigma, iters, verbose, savePath);
 }
 cv::Mat1f RTBDBS(const cv::Mat1f grayImg, cv::Mat1f initImg, int blkSize, int kernelSize, float sigma, int iters, bool verbose, std::string savePath) {
-    cv::Mat1i blkMap = VoidCluster(getRandBin(cv::Vec2i(grayImg.rows, grayImg.cols)), blkSize, sigma);
+    cv::Mat1i blkMap;  // Block Order from the Mask Cache
+    getVCMask(blkSize, kernelSize, sigma).convertTo(blkMap, CV_32S);
     return RTBDBS(grayImg, initImg, blkMap, kernelSize, sigma, iters, verbose, savePath);
 }
 cv::Mat1f RTBDBS(const cv::Mat1f grayImg, int blkSize, int kernelSize, float sigma, int iters, bool verbose, std::string savePath) {
     return RTBDBS(grayImg, getRandBin(cv::Vec2i(grayImg.rows, grayImg.cols)), blkSize, kernelSize, sigma, iters, verbose, savePath);
 }
+void RTBDBS(const cv::Mat1f grayImg, BitPlane& resBin, int blkSize, int kernelSize, float sigma, int iters, bool verbose, std::string savePath) {
+    cv::Mat1i blkMap;  // Block Order from the Mask Cache, resBin is left as is if the Block Size is out of Range
+    getVCMask(blkSize, kernelSize, sigma).convertTo(blkMap, CV_32S);
+    if (blkMap.empty()) return;
+    if (resBin.rows() != grayImg.rows || resBin.cols() != grayImg.cols) resBin = BitPlane(grayImg.rows, grayImg.cols), getRandBin(resBin);
+    resBin = BitPlane(RTBDBS(grayImg, resBin.toMat(), blkMap, kernelSize, sigma, iters, verbose, savePath));
+}
 
-// Dithering Halftoning
-cv::Mat1f Dither(const cv::Mat1f grayImg, int kernelSize, bool verbose) {
-    int height = grayImg.rows, width = grayImg.cols;
-    cv::Mat1f resImg = grayImg.clone();
-
-    // 1. Create Dither Matrix
-    cv::Mat1b ditherMat;
-    if (kernelSize == 2) ditherMat = tMap2;  // 2x2 Dithering Matrix
-    if (kernelSize == 4) ditherMat = tMap4;  // 4x4 Dithering Matrix
-    if (kernelSize == 8) ditherMat = tMap8;  // 8x8 Dithering Matrix
-    if (ditherMat.empty()) {
-        std::cerr << "Dithering Kernel Size is not Supported!" << std::endl;
-        return resImg;
+// Parallel Random Tiled Blocks Direct Binary Search (PRTB-DBS) Halftoning
+cv::Mat1f PRTBDBS(const cv::Mat1f grayImg, cv::Mat1f initImg, cv::Mat1i blkMap, int kernelSize, float sigma, int iters, int threads, bool verbose, std::string savePath) {
+    if (blkMap.empty()) {  // e.g. getVCMask with a Block Size out of Range
+        std::cerr << "Block Map of PRTB-DBS is empty!" << std::endl;
+        return cv::Mat1f();
     }
+    cv::Mat1f resImg = initImg.clone(), lsErrImg = initImg - grayImg;  // Result & Low-pass Error Image
+    cv::Mat1f psfMat = detail::getGSF(kernelSize, sigma);              // Gaussian PSF Kernel
+    std::string workFolder = saveData::defFolder;
+    int blkRows = (grayImg.rows + blkMap.rows - 1) / blkMap.rows;  // Block Rows (incl. a Partial one)
+    int blkCols = (grayImg.cols + blkMap.cols - 1) / blkMap.cols;  // Block Columns (incl. a Partial one)
+    int sepDist = 2 * kernelSize + 2;                              // Same Rank Pixels this far apart never interact (as P-DBS Tiles)
+    int strideR = (sepDist + blkMap.rows - 1) / blkMap.rows, strideC = (sepDist + blkMap.cols - 1) / blkMap.cols;
+    int rankNum = blkMap.rows * blkMap.cols, phaseNum = strideR * strideC;  // Rank Steps & Block Phases per Step
+    int workAmount = iters * rankNum, workCount = 0;                        // Recording Work Progress (by Rank Step)
+    int swapCount = 0, pixNum = grayImg.rows * grayImg.cols;                // Recording Swap Rate
+    double nStripes = threads > 0 ? threads : -1;                           // Stripes per Phase (the global Thread Number is left as is)
+    savePath = savePath.empty() ? verbosePath : savePath;                   // Set Save Path
 
-    // 2. Dithering Process
-    for (int row = 0; row < height; row++)
-        for (int col = 0; col < width; col++) {
-            int kRow = row % kernelSize, kCol = col % kernelSize;
-            if (grayImg(row, col) > (float)ditherMat(kRow, kCol) / (float)(kernelSize * kernelSize))
-                resImg(row, col) = 1;
-            else
-                resImg(row, col) = 0;
+    // 1. Generate Process Sequence by Block Map
+    std::vector<cv::Vec2i> blkSeq(rankNum);
+    for (int row = 0; row < blkMap.rows; row++)
+        for (int col = 0; col < blkMap.cols; col++) blkSeq[blkMap(row, col)] = {row, col};
+
+    // 2. Initialize Low-pass Error Image & PSF Correlation Tables
+    lsErrImg = filter::plConv(lsErrImg, psfMat);          // Low-pass Error Image
+    cv::Mat1f cppMat = detail::getCPP(psfMat);            // PSF Autocorrelation
+    cv::Mat1f cpeImg = detail::getCPE(lsErrImg, psfMat);  // PSF & Low-pass Error Cross-correlation
+    double errSum = cv::sum(lsErrImg.mul(lsErrImg))[0];   // Total Squared Low-pass Error (DBS Objective)
+    std::vector<int> blkSwap(blkRows * blkCols, 0);       // Swaps of each Block in the current Rank Step
+    std::vector<double> blkErr(blkRows * blkCols, 0);     // Delta Error of each Block in the current Rank Step
+    if (verbose) saveData::initVar(workFolder + "/" + savePath, "DBSlog");
+    if (verbose) saveData::imgMat(resImg, "resImg_0"), saveData::imgMat(lsErrImg, "errImg_0");
+    if (verbose) saveData::logData("Iter 0 Error", (float)(errSum / pixNum));
+
+    // 3. DBS Halftoning Iteration, Rank by Rank: the Pixel of this Rank in every Block (of one Phase) at once
+    for (int iter = 0; iter < iters; iter++) {
+        for (cv::Vec2i workPos : blkSeq) {
+            for (int phase = 0; phase < phaseNum; phase++) {
+                int phRow = phase / strideC, phCol = phase % strideC;
+                int phBlkRows = (blkRows - phRow + strideR - 1) / strideR, phBlkCols = (blkCols - phCol + strideC - 1) / strideC;
+                if (phBlkRows <= 0 || phBlkCols <= 0) continue;
+
+                cv::parallel_for_(cv::Range(0, phBlkRows * phBlkCols), [&](const cv::Range& range) {
+                    for (int idx = range.start; idx < range.end; idx++) {
+                        int blkR = (idx / phBlkCols) * strideR + phRow, blkC = (idx % phBlkCols) * strideC + phCol;
+                        int row = blkR * blkMap.rows + workPos[0], col = blkC * blkMap.cols + workPos[1];
+                        if (row >= grayImg.rows || col >= grayImg.cols) continue;  // Partial Blocks at the Edge
+
+                        // Calculate whether to Swap/Toggle or Not by Min Error
+                        float minErr = 0;
+                        cv::Vec2i minPos = {-1, -1};
+                        std::tie(minErr, minPos) = detail::searchPix(resImg, lsErrImg, cpeImg, cppMat, {row, col}, kernelSize, psfMat);
+                        if (minPos[0] == -1 || minPos[1] == -1) continue;
+
+                        // Update the Result Image, Low-pass Error Image & Cross-correlation Image
+                        detail::applySwap(resImg, lsErrImg, cpeImg, cppMat, {row, col}, minPos, kernelSize, psfMat);
+                        blkSwap[blkR * blkCols + blkC]++, blkErr[blkR * blkCols + blkC] += minErr;  // Update the Swap Rate & Delta Error of the Block
+                    }
+                }, nStripes);  // Barrier: every Block of this Phase is done before the next Phase / Rank
+            }
+            for (int idx = 0; idx < blkSwap.size(); idx++) swapCount += blkSwap[idx], errSum += blkErr[idx], blkSwap[idx] = 0, blkErr[idx] = 0;
+
+            if (verbose) {  // Show Progress
+                std::string title = "PRTB-DBS Itr: " + std::to_string(iter + 1);
+                std::string desc = "Swap Rate: " + std::to_string((int)((float)swapCount / (float)pixNum * 100)) + "%, Error: " + std::to_string(errSum / pixNum);
+                saveData::showProgress(title, (float)++workCount / (float)workAmount, desc);
+            }
         }
+        // Verbose Show the Result of Each Iteration
+        if (verbose) saveData::imgMat(resImg, "resImg_" + std::to_string(iter + 1)), saveData::imgMat(lsErrImg, "errImg_" + std::to_string(iter + 1));
+        // Verbose Save log for Each Iteration (Error is tracked by the accepted Delta Errors, no Rescan)
+        if (verbose) saveData::logData("Iter " + std::to_string(iter + 1) + " Error", (float)(errSum / pixNum));
+        if (verbose) saveData::logData("Iter " + std::to_string(iter + 1) + " Swap Rate", (float)swapCount / (float)pixNum * 100.0f);
+        swapCount = 0;  // Reset the Swap Rate
+    }
+    if (verbose) saveData::initVar(workFolder);
     return resImg;
 }
+cv::Mat1f PRTBDBS(const cv::Mat1f grayImg, cv::Mat1i blkMap, int kernelSize, float sigma, int iters, int threads, bool verbose, std::string savePath) {
+    return PRTBDBS(grayImg, getRandBin(cv::Vec2i(grayImg.rows, grayImg.cols)), blkMap, kernelSize, sigma, iters, threads, verbose, savePath);
+}
+cv::Mat1f PRTBDBS(const cv::Mat1f grayImg, cv::Mat1f initImg, int blkSize, int kernelSize, float sigma, int iters, int threads, bool verbose, std::string savePath) {
+    cv::Mat1i blkMap;  // Block Order from the Mask Cache
+    getVCMask(blkSize, kernelSize, sigma).convertTo(blkMap, CV_32S);
+    return PRTBDBS(grayImg, initImg, blkMap, kernelSize, sigma, iters, threads, verbose, savePath);
+}
+cv::Mat1f PRTBDBS(const cv::Mat1f grayImg, int blkSize, int kernelSize, float sigma, int iters, int threads, bool verbose, std::string savePath) {
+    return PRTBDBS(grayImg, getRandBin(cv::Vec2i(grayImg.rows, grayImg.cols)), blkSize, kernelSize, sigma, iters, threads, verbose, savePath);
+}
 
-cv::Mat1f Dither(const cv::Mat1f grayImg, cv::Mat1f dithMap, bool verbose) {
-    int height = grayImg.rows, width = grayImg.cols;
-    int dithH = dithMap.rows, dithW = dithMap.cols;
-    cv::Mat1f resImg = grayImg.clone();
+// Dithering Halftoning
+cv::Mat1f Dither(const cv::Mat1f grayImg, int kernelSize, bool verbose) {
+    BitPlane resBin;
+    Dither(grayImg, resBin, kernelSize);
+    return resBin.empty() ? grayImg.clone() : resBin.toMat();
+}
+void Dither(const cv::Mat1f grayImg, BitPlane& resBin, int kernelSize) {
+    cv::Mat1f thrTile = detail::bayerTile(kernelSize);
+    if (!thrTile.empty()) detail::ditherRows(grayImg, thrTile, resBin);
+}
+void Dither(const cv::Mat1b grayImg, BitPlane& resBin, int kernelSize) {
+    cv::Mat1f thrTile = detail::bayerTile(kernelSize);
+    if (!thrTile.empty()) detail::ditherRows(grayImg, detail::ditherTile(thrTile, CV_8U), resBin);
+}
+void Dither(const cv::Mat1w grayImg, BitPlane& resBin, int kernelSize) {
+    cv::Mat1f thrTile = detail::bayerTile(kernelSize);
+    if (!thrTile.empty()) detail::ditherRows(grayImg, detail::ditherTile(thrTile, CV_16U), resBin);
+}
 
-    for (int row = 0; row < height; row++)
-        for (int col = 0; col < width; col++) {
-            int dRow = row % dithH, dCol = col % dithW;
-            if (grayImg(row, col) > dithMap(dRow, dCol))
-                resImg(row, col) = 1;
-            else
-                resImg(row, col) = 0;
-        }
-    return resImg;
+cv::Mat1f Dither(const cv::Mat1f grayImg, cv::Mat1f dithMap, bool verbose) {
+    BitPlane resBin;
+    Dither(grayImg, dithMap, resBin);
+    return resBin.toMat();
+}
+void Dither(const cv::Mat1f grayImg, cv::Mat1f dithMap, BitPlane& resBin) {
+    detail::ditherRows(grayImg, dithMap, resBin);
+}
+void Dither(const cv::Mat1b grayImg, cv::Mat1f dithMap, BitPlane& resBin) {
+    detail::ditherRows(grayImg, detail::ditherTile(dithMap, CV_8U), resBin);
+}
+void Dither(const cv::Mat1w grayImg, cv::Mat1f dithMap, BitPlane& resBin) {
+    detail::ditherRows(grayImg, detail::ditherTile(dithMap, CV_16U), resBin);
 }
 
 // Error Diffusion Halftoning
 cv::Mat1f ErrDiff(const cv::Mat1f grayImg, int kernelSize, bool verbose) {
-    int height = grayImg.rows, width = grayImg.cols;
-    cv::Mat1f resImg = grayImg.clone(), errImg = cv::Mat1f::zeros(height, width);
+    BitPlane resBin;
+    ErrDiff(grayImg, resBin, kernelSize);
+    return resBin.empty() ? grayImg.clone() : resBin.toMat();
+}
+void ErrDiff(const cv::Mat1f grayImg, BitPlane& resBin, int kernelSize) {
+    if (kernelSize == 3) return ErrDiff(grayImg, resBin, "FS");   // Floyd-Steinberg Kernel
+    if (kernelSize == 5) return ErrDiff(grayImg, resBin, "JJN");  // JJN Kernel
+    std::cerr << "Error Diffusion Kernel Size is not Supported!" << std::endl;
+}
 
-    // 1. Create Error Diffusion Kernel
-    cv::Mat1b errKernel;
-    if (kernelSize == 3) errKernel = kFloydSteinberg;  // Floyd-Steinberg Kernel
-    if (kernelSize == 5) errKernel = kJJN;             // JJN Kernel
-    if (errKernel.empty()) {
-        std::cerr << "Error Diffusion Kernel Size is not Supported!" << std::endl;
-        return resImg;
+cv::Mat1f ErrDiff(const cv::Mat1f grayImg, std::string kernelName, bool serpentine) {
+    BitPlane resBin;
+    ErrDiff(grayImg, resBin, kernelName, serpentine);
+    return resBin.empty() ? grayImg.clone() : resBin.toMat();
+}
+void ErrDiff(const cv::Mat1f grayImg, BitPlane& resBin, std::string kernelName, bool serpentine) {
+    std::vector<float> errBuf;  // Rolling Error Rows
+    BitPlane resRows;
+    if (detail::diffuseStrip(kernelName, grayImg, resRows, 0, serpentine, errBuf)) resBin = resRows;
+}
+
+// Wavefront-parallel Error Diffusion
+cv::Mat1f PErrDiff(const cv::Mat1f grayImg, int kernelSize, int threads) {
+    BitPlane resBin;
+    PErrDiff(grayImg, resBin, kernelSize, threads);
+    return resBin.empty() ? grayImg.clone() : resBin.toMat();
+}
+void PErrDiff(const cv::Mat1f grayImg, BitPlane& resBin, int kernelSize, int threads) {
+    threads = std::max(1, std::min(threads > 0 ? threads : cv::getNumThreads(), grayImg.rows));
+    if (kernelSize == 3) return detail::wavefrontImg<detail::EDFloydSteinberg>(grayImg, resBin, threads);  // Floyd-Steinberg Kernel
+    if (kernelSize == 5) return detail::wavefrontImg<detail::EDJJN>(grayImg, resBin, threads);             // JJN Kernel
+    std::cerr << "Error Diffusion Kernel Size is not Supported!" << std::endl;
+}
+
+// Multi-level Dithering & Error Diffusion into a packed Frame Buffer
+void Dither(const cv::Mat1f grayImg, FrameBuffer& frame, int levels, int kernelSize) {
+    cv::Mat1f thrTile = detail::bayerTile(kernelSize);
+    if (!thrTile.empty() && detail::levelBits(levels) > 0) detail::ditherLevels(grayImg, thrTile, frame, levels);
+}
+void Dither(const cv::Mat1f grayImg, cv::Mat1f dithMap, FrameBuffer& frame, int levels) {
+    if (detail::levelBits(levels) > 0) detail::ditherLevels(grayImg, dithMap, frame, levels);
+}
+void ErrDiff(const cv::Mat1f grayImg, FrameBuffer& frame, int levels, std::string kernelName, bool serpentine) {
+    if (detail::levelBits(levels) > 0) detail::diffuseLevels(kernelName, grayImg, frame, levels, serpentine);
+}
+
+// Palette Error Diffusion Halftoning
+cv::Mat1b PaletteErrDiff(const cv::Mat3f colorImg, const std::vector<cv::Vec3f>& palette, int kernelSize, bool perceptual, int gridSize) {
+    cv::Mat1b edKernel = kernelSize == 3 ? kFloydSteinberg : kernelSize == 5 ? kJJN : cv::Mat1b();
+    if (edKernel.empty() || palette.empty() || palette.size() > 256 || gridSize < 2) {
+        std::cerr << "Palette Error Diffusion Setting is not Supported!" << std::endl;
+        return cv::Mat1b();
     }
+    int height = colorImg.rows, width = colorImg.cols, reach = edKernel.cols / 2, padWidth = width + 2 * reach;
 
-    // 2. Error Diffusion Process
-    int kSum = cv::sum(errKernel)[0];
-    for (int row = 0; row < height; row++)
+    // 1. Diffusion Space: BGR as is, or OKLab (the Box holds the BGR Cube & the Palette)
+    cv::Mat3f spaceImg = perceptual ? detail::bgr2OKLab(colorImg) : colorImg;
+    std::vector<cv::Vec3f> palVals = palette;
+    cv::Vec3f boxMin(0, 0, 0), boxMax(1, 1, 1), gridScale;
+    if (perceptual) {
+        for (cv::Vec3f& palVal : palVals) palVal = detail::bgr2OKLab(palVal);
+        boxMin = boxMax = detail::bgr2OKLab(cv::Vec3f(0, 0, 0));
+        for (int corner = 0; corner < 8 + palVals.size(); corner++) {
+            cv::Vec3f cornVal = corner < 8 ? detail::bgr2OKLab(cv::Vec3f(corner >> 2, (corner >> 1) & 1, corner & 1)) : palVals[corner - 8];
+            for (int ch = 0; ch < 3; ch++) boxMin[ch] = std::min(boxMin[ch], cornVal[ch]), boxMax[ch] = std::max(boxMax[ch], cornVal[ch]);
+        }
+    }
+    for (int ch = 0; ch < 3; ch++) gridScale[ch] = (gridSize - 1) / (boxMax[ch] - boxMin[ch]);
+    std::vector<uint8_t> lutVec = detail::paletteLUT(palVals, boxMin, boxMax, gridSize);
+
+    // 2. Taps of the Kernel (Current Pixel at Row 0, Center Column), Zero Weights dropped
+    std::vector<std::pair<int, float>> taps;  // (Row of the Error Buffer, Weight), Column Offset in tapCols
+    std::vector<int> tapCols;
+    float wgtSum = cv::sum(edKernel)[0];
+    for (int rdx = 0; rdx < edKernel.rows; rdx++)
+        for (int cdx = 0; cdx < edKernel.cols; cdx++)
+            if (edKernel(rdx, cdx) > 0) taps.push_back({rdx, edKernel(rdx, cdx) / wgtSum}), tapCols.push_back(cdx - reach);
+
+    // 3. Rolling Error Rows (Row r at r % rows), reach Columns of Padding per Side
+    std::vector<cv::Vec3f> errBuf(edKernel.rows * padWidth, cv::Vec3f(0, 0, 0));
+    cv::Mat1b idxImg(height, width);
+    for (int row = 0; row < height; row++) {
+        cv::Vec3f* errRow[3];  // Error Rows of row, row + 1, row + 2
+        for (int rdx = 0; rdx < edKernel.rows; rdx++) errRow[rdx] = errBuf.data() + ((row + rdx) % edKernel.rows) * padWidth + reach;
+        const cv::Vec3f* spaceRow = spaceImg[row];
+        uchar* idxRow = idxImg[row];
         for (int col = 0; col < width; col++) {
-            float grayVal = grayImg(row, col) + errImg(row, col);
-            float diffVal = grayVal - ((grayVal > 0.5) ? 1 : 0);
-
-            resImg(row, col) = (grayVal > 0.5) ? 1 : 0;  // Update the Result Image
-            for (int rdx = 0; rdx < errKernel.rows; rdx++)
-                for (int cdx = 0; cdx < errKernel.cols; cdx++) {  // Diffuse the Error
-                    int nRow = row + rdx, nCol = (col + cdx) - (errKernel.cols / 2);
-                    if (nRow < 0 || nRow >= height || nCol < 0 || nCol >= width) continue;
-                    errImg(nRow, nCol) += (errKernel(rdx, cdx) / (float)kSum) * diffVal;
-                }
+            // 3-1. Nearest Palette Color by one Lookup of the closest Grid Point
+            cv::Vec3f colorVal = spaceRow[col] + errRow[0][col];
+            int lutIdx = 0;
+            for (int ch = 0; ch < 3; ch++) {
+                colorVal[ch] = std::min(boxMax[ch], std::max(boxMin[ch], colorVal[ch]));
+                lutIdx = lutIdx * gridSize + (int)((colorVal[ch] - boxMin[ch]) * gridScale[ch] + 0.5f);
+            }
+            idxRow[col] = lutVec[lutIdx];
+
+            // 3-2. Diffuse the Vector Error
+            cv::Vec3f diffVal = colorVal - palVals[idxRow[col]];
+            for (int tap = 0; tap < taps.size(); tap++) errRow[taps[tap].first][col + tapCols[tap]] += diffVal * taps[tap].second;
         }
-    return resImg;
+        std::fill(errRow[0] - reach, errRow[0] - reach + padWidth, cv::Vec3f(0, 0, 0));  // Reused for row + rows
+    }
+    return idxImg;
+}
+cv::Mat3f applyPalette(const cv::Mat1b idxImg, const std::vector<cv::Vec3f>& palette) {
+    cv::Mat3f colorImg(idxImg.rows, idxImg.cols);
+    for (int row = 0; row < idxImg.rows; row++)
+        for (int col = 0; col < idxImg.cols; col++) colorImg(row, col) = palette[idxImg(row, col)];
+    return colorImg;
 }
 
 // Void & Cluster Dither Array Generation
 cv::Mat1f VoidCluster(const cv::Mat1f binImg, int kernelSize, float sigma, bool normalize, bool verbose) {
+    return VoidCluster(binImg, HalftoneContext(kernelSize, sigma), normalize, verbose);
+}
+cv::Mat1f VoidCluster(const cv::Mat1f binImg, const HalftoneContext& context, bool normalize, bool verbose) {
     int height = binImg.rows, width = binImg.cols, pixNum = height * width;
-    cv::Mat1i rankImg = detail::VCP1(binImg, kernelSize, sigma);  // Rank Image for Void & Cluster Dithering
-    detail::VCP2(binImg, rankImg, kernelSize, sigma);             // Rank the Void Part
-    detail::VCP3(binImg, rankImg, kernelSize, sigma);             // Rank the Cluster Part
-    if (normalize) rankImg /= pixNum;                             // Normalize the Rank Image
+    cv::Mat1f bkImg = binImg.clone();                         // Working Pattern (Phase 2 fills it up to Half)
+    cv::Mat1i rankImg(height, width);                         // Rank Image for Void & Cluster Dithering
+    detail::VCEnergy vcEnergy(binImg.size(), context.psfMat);  // Energy Map & Trees, shared by the Phases
+    detail::VCP1(bkImg, rankImg, vcEnergy);                   // Rank the Cluster Part
+    detail::VCP2(bkImg, rankImg, vcEnergy);                   // Rank the Void Part
+    detail::VCP3(bkImg, rankImg, vcEnergy);                   // Rank the Cluster Part
+    if (normalize) rankImg /= pixNum;                         // Normalize the Rank Image
     return rankImg;
 }
 
@@ -263,53 +693,33 @@ cv::Mat1f getRandBin(cv::Vec2i imgSize) {
         for (int col = 0; col < imgSize[1]; col++) randImg(row, col) = (rand() % 2 == 0) ? 0 : 1;
     return randImg;
 }
+void getRandBin(BitPlane& randBin) {
+    for (int row = 0; row < randBin.rows(); row++)
+        for (int col = 0; col < randBin.cols(); col++) randBin.set(row, col, rand() % 2 != 0);
+    return;
+}
 
 }  // namespace halftone
 
 namespace halftone::detail {  // Detail Functions
-// Gaussian Kernel for Halftoning
-cv::Mat1f getGSF(int kSize, float sigma) {
-    if (GSKernelSize != kSize || GSSigma != sigma) {
-        GSKernel = cv::Mat1f::zeros(kSize, kSize);
-        for (int row = 0; row < kSize; row++)
-            for (int col = 0; col < kSize; col++) {
-                float rVal = (row - kSize / 2) * (row - kSize / 2), cVal = (col - kSize / 2) * (col - kSize / 2);
-                GSKernel(row, col) = std::exp(-(rVal + cVal) / (2 * sigma * sigma));
-            }
-        GSKernelSize = kSize, GSSigma = sigma;
-    }
-    return GSKernel;
-}
-
-// Void & Cluster: Gaussian Filter with Periodic Boundary Condition
-cv::Mat1f VCFilter(const cv::Mat1f blkImg, int kSize, float sigma) {
-    int height = blkImg.rows, width = blkImg.cols;
-    cv::Mat1f resImg = cv::Mat1f::zeros(height, width);
+// Offsets of the 8 Swap Candidates around a Pixel (Raster Order)
+const int nbRow[8] = {-1, -1, -1, 0, 0, 1, 1, 1}, nbCol[8] = {-1, 0, 1, -1, 1, -1, 0, 1};
 
-    // 1. Create Gaussian PSF Kernel
-    cv::Mat1f psfMat = getGSF(kSize, sigma);
-
-    // 2. Filter the Block Image with Gaussian Filter
-    for (int row = 0; row < height; row++)
-        for (int col = 0; col < width; col++) {
-            float sumVal = 0;
-            for (int rdx = -kSize / 2; rdx <= kSize / 2; rdx++)
-                for (int cdx = -kSize / 2; cdx <= kSize / 2; cdx++) {
-                    int nRow = row + rdx, nCol = col + cdx;
-                    nRow = nRow < 0 ? nRow + height : nRow, nCol = nCol < 0 ? nCol + width : nCol;
-                    nRow = nRow >= height ? nRow - height : nRow, nCol = nCol >= width ? nCol - width : nCol;
-                    sumVal += psfMat(rdx + kSize / 2, cdx + kSize / 2) * blkImg(nRow, nCol);
-                }
-            resImg(row, col) = sumVal;
+// Gaussian Kernel for Halftoning (A new Matrix per Call, every Job keeps its own)
+cv::Mat1f getGSF(int kSize, float sigma) {
+    cv::Mat1f gskMat(kSize, kSize);
+    for (int row = 0; row < kSize; row++)
+        for (int col = 0; col < kSize; col++) {
+            float rVal = (row - kSize / 2) * (row - kSize / 2), cVal = (col - kSize / 2) * (col - kSize / 2);
+            gskMat(row, col) = std::exp(-(rVal + cVal) / (2 * sigma * sigma));
         }
-    return resImg;
+    return gskMat;
 }
 
 // Void & Cluster Phase 1: Rank the Cluster Part
-cv::Mat1i VCP1(const cv::Mat1f bkImg, int kSize, float sigma) {
+void VCP1(const cv::Mat1f bkImg, cv::Mat1i rkImg, VCEnergy& vcEnergy) {
     int height = bkImg.rows, width = bkImg.cols, rank = -1;
-    cv::Mat1f tmpBk = bkImg.clone();
-    cv::Mat1i rkImg = cv::Mat1f::zeros(height, width);
+    rkImg.setTo(0), vcEnergy.reset(bkImg);
 
     // 1. Calculate the Amount of 1s in the Block as rank value
     for (int row = 0; row < height; row++)
@@ -318,20 +728,17 @@ cv::Mat1i VCP1(const cv::Mat1f bkImg, int kSize, float sigma) {
 
     // 2. Rank the Value from sum(1s) to 0
     while (rank >= 0) {
-        cv::Mat1f dsMat = VCFilter(tmpBk, kSize, sigma);
-        cv::Vec3i maxPos = {-1, -1, -1};
-        for (int row = 0; row < height; row++)
-            for (int col = 0; col < width; col++)  // Find the Most Clustered Pixel
-                if (tmpBk(row, col) > 0.5 && dsMat(row, col) > maxPos[2]) maxPos = {row, col, (int)dsMat(row, col)};
-        tmpBk(maxPos[0], maxPos[1]) = 0;       // Remove the Clustered Pixel
-        rkImg(maxPos[0], maxPos[1]) = rank--;  // Rank the Clustered Pixel
+        cv::Vec2i maxPos = vcEnergy.cluster();  // Find the Most Clustered Pixel
+        vcEnergy.toggle(maxPos);                // Remove the Clustered Pixel
+        rkImg(maxPos[0], maxPos[1]) = rank--;   // Rank the Clustered Pixel
     }
-    return rkImg;
+    return;
 }
 
 // Void & Cluster Phase 2: Rank the Void Part
-void VCP2(cv::Mat1f bkImg, cv::Mat1i rkImg, int kSize, float sigma) {
+void VCP2(cv::Mat1f bkImg, cv::Mat1i rkImg, VCEnergy& vcEnergy) {
     int height = bkImg.rows, width = bkImg.cols, rank = 0;
+    vcEnergy.reset(bkImg);
 
     // 1. Find the Maximum Value of Rank Image, set the Rank Value = Max + 1
     for (int row = 0; row < height; row++)
@@ -340,46 +747,102 @@ void VCP2(cv::Mat1f bkImg, cv::Mat1i rkImg, int kSize, float sigma) {
 
     // 2. Rank the Value from 0 to sum(1s)
     while (rank < height * width / 2) {
-        cv::Mat1f dsMat = VCFilter(bkImg, kSize, sigma);
-        cv::Vec3i minPos = {-1, -1, 2};
-
-        for (int row = 0; row < height; row++)
-            for (int col = 0; col < width; col++)  // Find the Most Void Pixel
-                if (bkImg(row, col) == 0 && dsMat(row, col) < minPos[2]) minPos = {row, col, (int)dsMat(row, col)};
-        bkImg(minPos[0], minPos[1]) = 1;       // Add the Void Pixel
+        cv::Vec2i minPos = vcEnergy.largestVoid();  // Find the Most Void Pixel
+        vcEnergy.toggle(minPos);                    // Add the Void Pixel
+        bkImg(minPos[0], minPos[1]) = 1;
         rkImg(minPos[0], minPos[1]) = rank++;  // Rank the Void Pixel
     }
     return;
 }
 
 // Void & Cluster Phase 3: Rank the Cluster Part
-void VCP3(const cv::Mat1f bkImg, cv::Mat1i rkImg, int kSize, float sigma) {
+// ... The tightest Cluster of 0s in the reversed Image is the largest Void of 1s, so no Reversed Energy Map is needed
+void VCP3(const cv::Mat1f bkImg, cv::Mat1i rkImg, VCEnergy& vcEnergy) {
     int height = bkImg.rows, width = bkImg.cols, rank = 0;
-    cv::Mat1f psfMat = getGSF(kSize, sigma), bImg = bkImg.clone();
+    vcEnergy.reset(bkImg);
 
     // 1. Find the Maximum Value of Rank Image, set the Rank Value = Max + 1
     for (int row = 0; row < height; row++)
         for (int col = 0; col < width; col++) rank = std::max(rank, rkImg(row, col));
     rank++;
 
-    // 2. Reverse the image
+    // 2. Rank the Value from height*width/2 to height*width
+    while (rank < height * width) {
+        cv::Vec2i minPos = vcEnergy.largestVoid();  // Find the Most Clustered Pixel of the reversed Image
+        vcEnergy.toggle(minPos);                    // Remove the Clustered Pixel of the reversed Image
+        rkImg(minPos[0], minPos[1]) = rank++;       // Rank the Clustered Pixel
+    }
+    return;
+}
+
+// Void & Cluster: Allocate the Energy Map & both Tournament Trees for a Block Size
+VCEnergy::VCEnergy(cv::Size blkSize, const cv::Mat1f gskMat) {
+    height = blkSize.height, width = blkSize.width, leafNum = 1;
+    while (leafNum < height * width) leafNum *= 2;
+    psfMat = gskMat;
+    enImg.create(height, width), binImg.create(height, width);
+    maxTree.resize(2 * leafNum), minTree.resize(2 * leafNum);
+    touchIdx.reserve(gskMat.rows * gskMat.cols + 1);
+}
+VCEnergy::VCEnergy(const cv::Mat1f bkImg, const cv::Mat1f gskMat) : VCEnergy(bkImg.size(), gskMat) { reset(bkImg); }
+
+// Void & Cluster: Build the Energy Map & both Tournament Trees of a Pattern in place
+void VCEnergy::reset(const cv::Mat1f bkImg) {
+    cv::Mat enMat = enImg;
+    filter::pdConv(bkImg, psfMat, enMat);  // Gaussian Filter with Periodic Boundary (FFT from fftMinArea, once per Phase)
     for (int row = 0; row < height; row++)
-        for (int col = 0; col < width; col++) bImg(row, col) = std::abs(bImg(row, col) - 1);
+        for (int col = 0; col < width; col++) binImg(row, col) = bkImg(row, col) > 0.5;
 
-    // 3. Rank the Value from height*width/2 to height*width
-    while (rank < height * width) {
-        cv::Mat1f dsMat = VCFilter(bImg, kSize, sigma);
-        cv::Vec3i maxPos = {-1, -1, -1};
+    // Leaves hold the Pixel Index if it takes Part in the Tree, otherwise -1, then play every Match once
+    std::fill(maxTree.begin(), maxTree.end(), -1), std::fill(minTree.begin(), minTree.end(), -1);
+    for (int idx = 0; idx < height * width; idx++) (binImg(idx / width, idx % width) ? maxTree : minTree)[leafNum + idx] = idx;
+    for (int node = leafNum - 1; node >= 1; node--) {
+        maxTree[node] = winner(maxTree[2 * node], maxTree[2 * node + 1], true);
+        minTree[node] = winner(minTree[2 * node], minTree[2 * node + 1], false);
+    }
+}
 
-        for (int row = 0; row < height; row++)
-            for (int col = 0; col < width; col++)  // Find the Most Clustered Pixel
-                if (bImg(row, col) == 1 && dsMat(row, col) > maxPos[2]) maxPos = {row, col, (int)dsMat(row, col)};
-        bImg(maxPos[0], maxPos[1]) = 0;        // Remove the Clustered Pixel
-        rkImg(maxPos[0], maxPos[1]) = rank++;  // Rank the Clustered Pixel
+// Void & Cluster: Winner of a Match, Higher (Cluster) or Lower (Void) Energy, Ties go to the first Pixel in Raster Order
+int VCEnergy::winner(int idxA, int idxB, bool isMax) const {
+    if (idxA < 0 || idxB < 0) return std::max(idxA, idxB);
+    float enA = enImg(idxA / width, idxA % width), enB = enImg(idxB / width, idxB % width);
+    if (enA == enB) return std::min(idxA, idxB);
+    return (isMax ? enA > enB : enA < enB) ? idxA : idxB;
+}
+
+// Void & Cluster: Replay the Matches from the Leaf of a Pixel up to the Root
+void VCEnergy::replay(int idx) {
+    bool isOne = binImg(idx / width, idx % width);
+    maxTree[leafNum + idx] = isOne ? idx : -1, minTree[leafNum + idx] = isOne ? -1 : idx;
+    for (int node = (leafNum + idx) / 2; node >= 1; node /= 2) {
+        maxTree[node] = winner(maxTree[2 * node], maxTree[2 * node + 1], true);
+        minTree[node] = winner(minTree[2 * node], minTree[2 * node + 1], false);
     }
     return;
 }
 
+// Void & Cluster: Add or Remove a Pixel, only its periodic PSF Footprint of the Energy Map changes
+void VCEnergy::toggle(cv::Vec2i pos) {
+    int half = psfMat.rows / 2;
+    float sign = binImg(pos[0], pos[1]) ? -1.0f : 1.0f;
+    binImg(pos[0], pos[1]) = !binImg(pos[0], pos[1]);
+
+    for (int rdx = -half; rdx <= half; rdx++)
+        for (int cdx = -half; cdx <= half; cdx++) {
+            int nRow = ((pos[0] + rdx) % height + height) % height, nCol = ((pos[1] + cdx) % width + width) % width;
+            enImg(nRow, nCol) += sign * psfMat(rdx + half, cdx + half);
+        }
+    // Replay the Footprint (Deduplicated, a Block smaller than the PSF wraps onto itself) & the Pixel itself
+    touchIdx.assign(1, pos[0] * width + pos[1]);
+    for (int rdx = -half; rdx <= half; rdx++)
+        for (int cdx = -half; cdx <= half; cdx++)
+            touchIdx.push_back(((pos[0] + rdx) % height + height) % height * width + ((pos[1] + cdx) % width + width) % width);
+    std::sort(touchIdx.begin(), touchIdx.end());
+    touchIdx.erase(std::unique(touchIdx.begin(), touchIdx.end()), touchIdx.end());
+    for (int idx : touchIdx) replay(idx);
+    return;
+}
+
 // DBS: Calculate Delta Error for Swap/Toggle Condition
 float deltaLpErr(const cv::Mat1f lpErrImg, cv::Vec3i posCent, cv::Vec3i posSwap, int kSize, const cv::Mat1f gskMat) {
     float deltaErr = 0;
@@ -393,28 +856,758 @@ float deltaLpErr(const cv::Mat1f lpErrImg, cv::Vec3i posCent, cv::Vec3i posSwap,
                       swapDist = {pixRow - posSwap[0] + kSize / 2, pixCol - posSwap[1] + kSize / 2};
             if (pixRow < 0 || pixRow >= lpErrImg.rows || pixCol < 0 || pixCol >= lpErrImg.cols) continue;
             if (centDist[0] >= 0 && centDist[1] >= 0 && centDist[0] < kSize && centDist[1] < kSize)
-                smallDeltaE += GSKernel(centDist[0], centDist[1]) * togCent;  // Calculate Small Delta E with Center Pixel
+                smallDeltaE += gskMat(centDist[0], centDist[1]) * togCent;  // Calculate Small Delta E with Center Pixel
             if (swapDist[0] >= 0 && swapDist[1] >= 0 && swapDist[0] < kSize && swapDist[1] < kSize)
-                smallDeltaE += GSKernel(swapDist[0], swapDist[1]) * togSwap;  // Calculate Small Delta E with Swap Pixel
-            deltaErr += std::pow(smallDeltaE + lpErrImg(pixRow, pixCol), 2) - std::pow(lpErrImg(pixRow, pixCol), 2);
+                smallDeltaE += gskMat(swapDist[0], swapDist[1]) * togSwap;  // Calculate Small Delta E with Swap Pixel
+            double newErr = smallDeltaE + lpErrImg(pixRow, pixCol), oldErr = lpErrImg(pixRow, pixCol);
+            deltaErr += newErr * newErr - oldErr * oldErr;
         }
 
     return deltaErr;
 }
 
-// DBS: Alter & Update the low-pass Error Image by Swap/Toggle Condition
-cv::Mat1f altLpErr(const cv::Mat1f lpErrImg, cv::Vec3i posPix, int kSize, const cv::Mat1f gskMat) {
-    int height = lpErrImg.rows, width = lpErrImg.cols;
-    cv::Mat1f resLpErr = lpErrImg.clone();
+// DBS: PSF Autocorrelation Table c_pp, (2K-1) x (2K-1), Centered at (K-1, K-1)
+cv::Mat1f getCPP(const cv::Mat1f gskMat) {
+    int kSize = gskMat.rows, reach = kSize - 1;
+    cv::Mat1f cppMat = cv::Mat1f::zeros(2 * kSize - 1, 2 * kSize - 1);
 
-    for (int rdx = -kSize / 2; rdx <= kSize / 2; rdx++)
-        for (int cdx = -kSize / 2; cdx <= kSize / 2; cdx++) {
-            int nRow = posPix[0] + rdx, nCol = posPix[1] + cdx;
-            int distRow = kSize / 2 + rdx, distCol = kSize / 2 + cdx;
+    for (int dRow = -reach; dRow <= reach; dRow++)
+        for (int dCol = -reach; dCol <= reach; dCol++) {
+            double sumVal = 0;
+            for (int row = std::max(0, -dRow); row < std::min(kSize, kSize - dRow); row++)
+                for (int col = std::max(0, -dCol); col < std::min(kSize, kSize - dCol); col++)
+                    sumVal += gskMat(row, col) * gskMat(row + dRow, col + dCol);
+            cppMat(dRow + reach, dCol + reach) = sumVal;
+        }
+    return cppMat;
+}
+
+// DBS: PSF & Low-pass Error Cross-correlation c_pe (Only Valid where the K x K Footprint is inside the Image)
+cv::Mat1f getCPE(const cv::Mat1f lpErrImg, const cv::Mat1f gskMat) {
+    cv::Mat1f cpeImg;
+    getCPE(lpErrImg, gskMat, cpeImg);
+    return cpeImg;
+}
+void getCPE(const cv::Mat1f lpErrImg, const cv::Mat1f gskMat, cv::Mat1f& cpeImg) {
+    int height = lpErrImg.rows, width = lpErrImg.cols, half = gskMat.rows / 2;
+
+    // Large Kernels: Correlate in the Frequency Domain, then clear the Border Ring
+    if (gskMat.rows * gskMat.cols >= filter::fftMinArea) {
+        filter::fftConv(lpErrImg, gskMat, cpeImg, false);
+        if (height <= 2 * half || width <= 2 * half) return (void)cpeImg.setTo(0);
+        cpeImg.rowRange(0, half).setTo(0), cpeImg.rowRange(height - half, height).setTo(0);
+        cpeImg.colRange(0, half).setTo(0), cpeImg.colRange(width - half, width).setTo(0);
+        return;
+    }
+    cpeImg.create(height, width);
+    cpeImg.setTo(0);
+    for (int row = half; row < height - half; row++)
+        for (int col = half; col < width - half; col++) {
+            double sumVal = 0;
+            for (int rdx = -half; rdx <= half; rdx++)
+                for (int cdx = -half; cdx <= half; cdx++) sumVal += gskMat(rdx + half, cdx + half) * lpErrImg(row + rdx, col + cdx);
+            cpeImg(row, col) = sumVal;
+        }
+}
+
+// DBS: Calculate Delta Error for Swap/Toggle Condition by c_pp & c_pe Table Lookups
+float deltaCpe(const cv::Mat1f cpeImg, const cv::Mat1f cppMat, cv::Vec3i posCent, cv::Vec3i posSwap) {
+    int reach = cppMat.rows / 2, togCent = posCent[2], togSwap = posSwap[2];
+    int dRow = posCent[0] - posSwap[0], dCol = posCent[1] - posSwap[1];
+    double deltaErr = (double)(togCent * togCent + togSwap * togSwap) * cppMat(reach, reach);
+
+    deltaErr += 2.0 * togCent * cpeImg(posCent[0], posCent[1]);
+    if (togSwap == 0) return deltaErr;  // Toggle Condition
+    deltaErr += 2.0 * togSwap * cpeImg(posSwap[0], posSwap[1]);
+    if (std::abs(dRow) <= reach && std::abs(dCol) <= reach) deltaErr += 2.0 * togCent * togSwap * cppMat(dRow + reach, dCol + reach);
+    return deltaErr;
+}
+
+// DBS: Alter & Update the low-pass Error Image by Swap/Toggle Condition (In-place, K x K Footprint Only, Scaled by the Plane Weight)
+void altLpErr(cv::Mat1f& lpErrImg, cv::Vec3i posPix, int kSize, const cv::Mat1f gskMat, float plnWgt) {
+    int height = lpErrImg.rows, width = lpErrImg.cols, half = kSize / 2;
+    if (posPix[2] == 0) return;  // Nothing to Alter
+
+    // 1. Clip the Footprint to the Image Boundary
+    int rowSt = std::max(posPix[0] - half, 0), rowEd = std::min(posPix[0] + half, height - 1);
+    int colSt = std::max(posPix[1] - half, 0), colEd = std::min(posPix[1] + half, width - 1);
+
+    // 2. Add the PSF to the Footprint
+    for (int nRow = rowSt; nRow <= rowEd; nRow++) {
+        float* errRow = lpErrImg.ptr<float>(nRow);
+        const float* psfRow = gskMat.ptr<float>(nRow - posPix[0] + half);
+        for (int nCol = colSt; nCol <= colEd; nCol++) errRow[nCol] += psfRow[nCol - posPix[1] + half] * (posPix[2] * plnWgt);
+    }
+    return;
+}
+
+// DBS: Alter & Update the c_pe Image by Swap/Toggle Condition (In-place, Inner Pixels Only, Scaled by the Plane Weight)
+void altCpe(cv::Mat1f& cpeImg, const cv::Mat1f cppMat, cv::Vec3i posPix, int kSize, float plnWgt) {
+    int height = cpeImg.rows, width = cpeImg.cols, half = kSize / 2, reach = kSize - 1;
+    if (posPix[2] == 0) return;  // Nothing to Alter
+
+    // 1. Clip the (2K-1) x (2K-1) Footprint to the Inner Region
+    int rowSt = std::max(posPix[0] - reach, half), rowEd = std::min(posPix[0] + reach, height - 1 - half);
+    int colSt = std::max(posPix[1] - reach, half), colEd = std::min(posPix[1] + reach, width - 1 - half);
+
+    // 2. Add the PSF Autocorrelation to the Footprint
+    for (int nRow = rowSt; nRow <= rowEd; nRow++) {
+        float* cpeRow = cpeImg.ptr<float>(nRow);
+        const float* cppRow = cppMat.ptr<float>(nRow - posPix[0] + reach);
+        for (int nCol = colSt; nCol <= colEd; nCol++) cpeRow[nCol] += cppRow[nCol - posPix[1] + reach] * (posPix[2] * plnWgt);
+    }
+    return;
+}
+
+// DBS: Search the Swap/Toggle with Min Delta Error in the 3x3 Neighborhood of a Pixel
+std::pair<float, cv::Vec2i> searchPix(const cv::Mat1f resImg, const cv::Mat1f lpErrImg, const cv::Mat1f cpeImg, const cv::Mat1f cppMat, cv::Vec2i posPix, int kSize, const cv::Mat1f gskMat) {
+    int height = resImg.rows, width = resImg.cols, half = kSize / 2, row = posPix[0], col = posPix[1];
+    float minErr = 0;
+    cv::Vec2i minPos = {-1, -1};
+    auto isInner = [&](int pRow, int pCol) { return pRow >= half && pRow < height - half && pCol >= half && pCol < width - half; };
+    if (isInner(row - 1, col - 1) && isInner(row + 1, col + 1)) return searchPixInner(resImg, cpeImg, cppMat, posPix);  // Fast Path
+
+    // 1. Swap Condition, use the Tables if both Footprints are inside the Image, otherwise the Direct Window Sum
+    cv::Vec3i posCent = {row, col, (int)resImg(row, col) == 0 ? 1 : -1};
+    for (int rdx = -1; rdx <= 1; rdx++)
+        for (int cdx = -1; cdx <= 1; cdx++) {
+            int nRow = row + rdx, nCol = col + cdx;
             if (nRow < 0 || nRow >= height || nCol < 0 || nCol >= width) continue;
-            resLpErr(nRow, nCol) += GSKernel(distRow, distCol) * posPix[2];
+            if (resImg(nRow, nCol) == resImg(row, col)) continue;
+            cv::Vec3i posSwap = {nRow, nCol, (int)resImg(nRow, nCol) == 0 ? 1 : -1};
+            float deltaErr = isInner(row, col) && isInner(nRow, nCol) ? deltaCpe(cpeImg, cppMat, posCent, posSwap)
+                                                                       : deltaLpErr(lpErrImg, posCent, posSwap, kSize, gskMat);
+            if (deltaErr < minErr) minErr = deltaErr, minPos = {nRow, nCol};
         }
-    return resLpErr;
+    // 2. Toggle Condition
+    cv::Vec3i posSwap = {row, col, 0};
+    float deltaErr = isInner(row, col) ? deltaCpe(cpeImg, cppMat, posCent, posSwap) : deltaLpErr(lpErrImg, posCent, posSwap, kSize, gskMat);
+    if (deltaErr < minErr) minErr = deltaErr, minPos = {row, col};
+    return {minErr, minPos};
+}
+
+// DBS: Evaluate all 9 Swap/Toggle Candidates of an Inner Pixel at once
+// ... Same Arithmetic & Candidate Order as deltaCpe in searchPix, so the Result is bit-identical
+std::pair<float, cv::Vec2i> searchPixInner(const cv::Mat1f resImg, const cv::Mat1f cpeImg, const cv::Mat1f cppMat, cv::Vec2i posPix) {
+    int row = posPix[0], col = posPix[1], reach = cppMat.rows / 2;
+    float resCent = resImg(row, col), minErr = 0;
+    alignas(32) double resNb[8], cpeNb[8], cppNb[8];
+
+    // 1. Load the 3x3 Neighborhood once
+    for (int idx = 0; idx < 8; idx++) {
+        resNb[idx] = resImg(row + nbRow[idx], col + nbCol[idx]);
+        cpeNb[idx] = cpeImg(row + nbRow[idx], col + nbCol[idx]);
+        cppNb[idx] = cppMat(reach - nbRow[idx], reach - nbCol[idx]);
+    }
+
+    // 2. Find the Min Error Candidate
+    int minIdx = minCandidate(resNb, cpeNb, cppNb, resCent, cpeImg(row, col), cppMat(reach, reach), minErr);
+    if (minIdx == -1) return {minErr, {-1, -1}};
+    if (minIdx == 8) return {minErr, {row, col}};
+    return {minErr, {row + nbRow[minIdx], col + nbCol[minIdx]}};
+}
+
+// Error Diffusion: Quantizers, store the Output of a Pixel & return its Gray Value
+struct BinQuant {  // 1 Bit per Pixel into a BitPlane Row
+    uint64_t* bitRow;
+    float operator()(int col, float grayVal) const {
+        bitRow[col >> 6] |= (uint64_t)(grayVal > 0.5) << (col & 63);
+        return (grayVal > 0.5) ? 1 : 0;
+    }
+};
+struct LevelQuant {  // Nearest of levels Gray Levels into a FrameBuffer Row (Binary: same Decision as BinQuant)
+    uint8_t* byteRow;
+    int levels, bpp, slotMask, slotShift;  // Pixels per Byte is slotMask + 1 = 1 << slotShift
+    bool msbFirst;
+    float operator()(int col, float grayVal) const {
+        int level = std::min(levels - 1, std::max(0, (int)std::ceil(grayVal * (levels - 1) - 0.5f)));
+        int slot = col & slotMask;
+        byteRow[col >> slotShift] |= level << (msbFirst ? 8 - bpp * (slot + 1) : bpp * slot);
+        return level / (float)(levels - 1);
+    }
+};
+
+// Error Diffusion: Quantize Pixels [idxSt, idxEd) of a Row in the Scan Direction, the Taps unroll as Kernel is known at Compile Time
+template <class Kernel, bool reverse, class Quant>
+static void diffuseRow(const float* grayRow, float* const* errRow, const Quant& quant, int width, int idxSt, int idxEd) {
+    constexpr int reach = Kernel::cols / 2, step = reverse ? -1 : 1;
+    for (int idx = idxSt; idx < idxEd; idx++) {
+        int col = reverse ? width - 1 - idx : idx;
+        float grayVal = grayRow[col] + errRow[0][col];
+        float diffVal = grayVal - quant(col, grayVal);  // Update the Result Image
+
+        for (int rdx = 0; rdx < Kernel::rows; rdx++)
+            for (int cdx = 0; cdx < Kernel::cols; cdx++) {  // Diffuse the Error, Taps past the Border land in the Padding
+                if (Kernel::wgt[rdx][cdx] == 0) continue;
+                errRow[rdx][col + step * (cdx - reach)] += (Kernel::wgt[rdx][cdx] / (float)Kernel::sum) * diffVal;
+            }
+    }
+}
+
+// Error Diffusion: Diffuse a Strip of Rows with a Kernel Table, rowQuant(row) gives the Quantizer of a Strip Row
+template <class Kernel, class RowQuant>
+static void diffuseRows(const cv::Mat1f grayRows, int rowOff, bool serpentine, std::vector<float>& errBuf, RowQuant rowQuant) {
+    constexpr int reach = Kernel::cols / 2;
+    int height = grayRows.rows, width = grayRows.cols, padWidth = width + 2 * reach;
+    if (errBuf.empty()) errBuf.assign(Kernel::rows * padWidth, 0.0f);  // Rolling Error Rows (Row r at r % rows), reach Columns of Padding per Side
+
+    for (int row = 0; row < height; row++) {
+        int imgRow = rowOff + row;
+        float* errRow[Kernel::rows];  // Error Rows of imgRow, imgRow + 1, ...
+        for (int rdx = 0; rdx < Kernel::rows; rdx++) errRow[rdx] = errBuf.data() + ((imgRow + rdx) % Kernel::rows) * padWidth + reach;
+        if (serpentine && imgRow % 2 == 1)
+            diffuseRow<Kernel, true>(grayRows[row], errRow, rowQuant(row), width, 0, width);
+        else
+            diffuseRow<Kernel, false>(grayRows[row], errRow, rowQuant(row), width, 0, width);
+        std::fill(errRow[0] - reach, errRow[0] - reach + padWidth, 0.0f);  // Reused for imgRow + rows
+    }
+}
+
+// Error Diffusion: Call func with the Kernel Table of a Name (as an empty Tag Object), false if not supported
+template <class Func>
+static bool withKernel(const std::string& kernelName, Func func) {
+    if (kernelName == "FS") return func(EDFloydSteinberg()), true;
+    if (kernelName == "JJN") return func(EDJJN()), true;
+    if (kernelName == "Stucki") return func(EDStucki()), true;
+    if (kernelName == "Sierra") return func(EDSierra()), true;
+    if (kernelName == "Burkes") return func(EDBurkes()), true;
+    if (kernelName == "Atkinson") return func(EDAtkinson()), true;
+    std::cerr << "Error Diffusion Kernel [" << kernelName << "] is not Supported!" << std::endl;
+    return false;
+}
+
+bool diffuseStrip(std::string kernelName, const cv::Mat1f grayRows, BitPlane& resRows, int rowOff, bool serpentine, std::vector<float>& errBuf) {
+    return withKernel(kernelName, [&](auto kernel) {
+        resRows = BitPlane(grayRows.rows, grayRows.cols);
+        diffuseRows<decltype(kernel)>(grayRows, rowOff, serpentine, errBuf, [&](int row) { return BinQuant{resRows.rowPtr(row)}; });
+    });
+}
+
+bool diffuseLevels(std::string kernelName, const cv::Mat1f grayImg, FrameBuffer& frame, int levels, bool serpentine) {
+    std::vector<float> errBuf;
+    return withKernel(kernelName, [&](auto kernel) {
+        int bpp = levelBits(levels), slotShift = 3 - (bpp >> 1);  // 8, 4 or 2 Pixels per Byte
+        frame = FrameBuffer(grayImg.rows, grayImg.cols, bpp, frame.msbFirst());
+        diffuseRows<decltype(kernel)>(grayImg, 0, serpentine, errBuf, [&](int row) {
+            return LevelQuant{frame.rowPtr(row), levels, bpp, (1 << slotShift) - 1, slotShift, frame.msbFirst()};
+        });
+    });
+}
+
+// Error Diffusion: Wavefront over the Rows of the Image, full-frame Error Rows as Rows in flight share them
+template <class Kernel>
+void wavefrontImg(const cv::Mat1f grayImg, BitPlane& resBin, int threads) {
+    constexpr int reach = Kernel::cols / 2;
+    int height = grayImg.rows, width = grayImg.cols, padWidth = width + 2 * reach;
+    std::vector<float> errBuf((size_t)(height + Kernel::rows) * padWidth, 0.0f);  // Error Rows, reach Columns of Padding per Side
+
+    // 1. Column Lag: Row r + 1 may work on a Column once Row r is 2R + 1 Columns further, so the Writes of Row r
+    //    into a shared Error Row are all done before the ones of Row r + 1 start, and never overlap in Time
+    int colLag = 2 * reach + 1, pubStep = 16;  // Progress is published every pubStep Pixels
+    struct alignas(64) RowProgress {
+        std::atomic<int> done{0};  // Finished Columns of the Row
+    };
+    std::vector<RowProgress> progress(height);
+
+    // 2. Rows are dealt to the Threads in Turn (Row r to Thread r % threads), so a waited Row is always running
+    resBin = BitPlane(height, width);
+    auto diffuseRows = [&](int thread) {
+        for (int row = thread; row < height; row += threads) {
+            float* errRow[Kernel::rows];
+            for (int rdx = 0; rdx < Kernel::rows; rdx++) errRow[rdx] = errBuf.data() + (size_t)(row + rdx) * padWidth + reach;
+            int seenDone = row == 0 ? width : 0;  // Last seen Progress of the Row above
+            for (int colSt = 0; colSt < width; colSt += pubStep) {
+                int colEd = std::min(width, colSt + pubStep), needDone = std::min(width, colEd - 1 + colLag);
+                while (seenDone < needDone) {
+                    seenDone = progress[row - 1].done.load(std::memory_order_acquire);
+                    if (seenDone < needDone) std::this_thread::yield();
+                }
+                diffuseRow<Kernel, false>(grayImg[row], errRow, BinQuant{resBin.rowPtr(row)}, width, colSt, colEd);
+                progress[row].done.store(colEd, std::memory_order_release);
+            }
+        }
+    };
+    std::vector<std::thread> workers;
+    for (int thread = 1; thread < threads; thread++) workers.emplace_back(diffuseRows, thread);
+    diffuseRows(0);
+    for (std::thread& worker : workers) worker.join();
+}
+template void wavefrontImg<EDFloydSteinberg>(const cv::Mat1f, BitPlane&, int);
+template void wavefrontImg<EDJJN>(const cv::Mat1f, BitPlane&, int);
+
+
+// Palette: Nearest Palette Color of every Grid Point (Euclidean, in the Space of the Palette Values)
+std::vector<uint8_t> paletteLUT(const std::vector<cv::Vec3f>& palVals, cv::Vec3f boxMin, cv::Vec3f boxMax, int gridSize) {
+    std::vector<uint8_t> lutVec((size_t)gridSize * gridSize * gridSize);
+    for (int idx = 0; idx < lutVec.size(); idx++) {
+        int gridPos[3] = {idx / (gridSize * gridSize), idx / gridSize % gridSize, idx % gridSize};
+        cv::Vec3f gridVal;
+        for (int ch = 0; ch < 3; ch++) gridVal[ch] = boxMin[ch] + (boxMax[ch] - boxMin[ch]) * gridPos[ch] / (gridSize - 1);
+        float minDist = std::numeric_limits<float>::max();
+        for (int pal = 0; pal < palVals.size(); pal++) {
+            cv::Vec3f diffVal = gridVal - palVals[pal];
+            float palDist = diffVal.dot(diffVal);
+            if (palDist < minDist) minDist = palDist, lutVec[idx] = pal;
+        }
+    }
+    return lutVec;
+}
+
+// Palette: BGR to OKLab through XYZ
+cv::Vec3f bgr2OKLab(cv::Vec3f bgrVal) {
+    return colorconvert::XYZ2OKLAB(colorconvert::RGB2XYZ(cv::Vec3f(bgrVal[2], bgrVal[1], bgrVal[0])));
+}
+cv::Mat3f bgr2OKLab(const cv::Mat3f bgrImg) {
+    cv::Mat1f lmsMat = colorconvert::_cvtMat_XYZ2LMS[0] * colorconvert::_cvtMat_RGB2XYZ[0];
+    cv::flip(lmsMat, lmsMat, 1);  // RGB Columns to BGR Columns
+    cv::Mat3f lmsImg, labImg;
+    cv::transform(bgrImg, lmsImg, lmsMat);
+    for (int row = 0; row < lmsImg.rows; row++)
+        for (int col = 0; col < lmsImg.cols; col++)
+            for (int ch = 0; ch < 3; ch++) lmsImg(row, col)[ch] = std::cbrt(lmsImg(row, col)[ch]);  // f(x) = x^(1/3), Sign kept
+    cv::transform(lmsImg, labImg, colorconvert::_cvtMat_LMS2OKL[0]);
+    return labImg;
+}
+
+// Dithering: Bayer Thresholds (Rank / Size^2)
+cv::Mat1f bayerTile(int kSize) {
+    cv::Mat1b ditherMat;
+    if (kSize == 2) ditherMat = tMap2;  // 2x2 Dithering Matrix
+    if (kSize == 4) ditherMat = tMap4;  // 4x4 Dithering Matrix
+    if (kSize == 8) ditherMat = tMap8;  // 8x8 Dithering Matrix
+    if (ditherMat.empty()) {
+        std::cerr << "Dithering Kernel Size is not Supported!" << std::endl;
+        return cv::Mat1f();
+    }
+    cv::Mat1f thrTile(kSize, kSize);
+    for (int row = 0; row < kSize; row++)
+        for (int col = 0; col < kSize; col++) thrTile(row, col) = (float)ditherMat(row, col) / (float)(kSize * kSize);
+    return thrTile;
+}
+
+// Dithering: Thresholds in the Domain of the Input, v > floor(t * Max) holds exactly when v / Max > t for an Integer v
+cv::Mat ditherTile(const cv::Mat1f thrMap, int depth) {
+    if (depth == CV_32F) return thrMap;
+    double maxVal = depth == CV_8U ? 255.0 : 65535.0;
+    cv::Mat1w thrTile(thrMap.rows, thrMap.cols);
+    for (int row = 0; row < thrMap.rows; row++)
+        for (int col = 0; col < thrMap.cols; col++) thrTile(row, col) = (uint16_t)std::clamp(std::floor(thrMap(row, col) * maxVal), 0.0, maxVal);
+    cv::Mat resTile;
+    thrTile.convertTo(resTile, depth);
+    return resTile;
+}
+
+// Dithering: Bits of 64 Pixels, Bit k is set if Pixel k is above its Threshold
+static uint64_t ditherWord(const uint8_t* grayPix, const uint8_t* thrPix) {
+    uint64_t word = 0;
+#if defined(__AVX2__)
+    for (int idx = 0; idx < 64; idx += 32) {  // a > b <=> min(a, b) != a (Unsigned)
+        __m256i grayVec = _mm256_loadu_si256((const __m256i*)(grayPix + idx)), thrVec = _mm256_loadu_si256((const __m256i*)(thrPix + idx));
+        word |= (uint64_t)(uint32_t)~_mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_min_epu8(grayVec, thrVec), grayVec)) << idx;
+    }
+#elif defined(__SSE2__)
+    for (int idx = 0; idx < 64; idx += 16) {
+        __m128i grayVec = _mm_loadu_si128((const __m128i*)(grayPix + idx)), thrVec = _mm_loadu_si128((const __m128i*)(thrPix + idx));
+        word |= (uint64_t)(~_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_min_epu8(grayVec, thrVec), grayVec)) & 0xFFFF) << idx;
+    }
+#else
+    for (int idx = 0; idx < 64; idx++) word |= (uint64_t)(grayPix[idx] > thrPix[idx]) << idx;
+#endif
+    return word;
+}
+static uint64_t ditherWord(const uint16_t* grayPix, const uint16_t* thrPix) {
+    uint64_t word = 0;
+#if defined(__AVX2__)
+    const __m256i signBit = _mm256_set1_epi16((short)0x8000);  // Unsigned Order by flipping the Sign
+    for (int idx = 0; idx < 64; idx += 32) {
+        __m256i cmpLo = _mm256_cmpgt_epi16(_mm256_xor_si256(_mm256_loadu_si256((const __m256i*)(grayPix + idx)), signBit), _mm256_xor_si256(_mm256_loadu_si256((const __m256i*)(thrPix + idx)), signBit));
+        __m256i cmpHi = _mm256_cmpgt_epi16(_mm256_xor_si256(_mm256_loadu_si256((const __m256i*)(grayPix + idx + 16)), signBit), _mm256_xor_si256(_mm256_loadu_si256((const __m256i*)(thrPix + idx + 16)), signBit));
+        __m256i cmpAll = _mm256_permute4x64_epi64(_mm256_packs_epi16(cmpLo, cmpHi), 0xD8);  // Packs work per 128-bit Lane
+        word |= (uint64_t)(uint32_t)_mm256_movemask_epi8(cmpAll) << idx;
+    }
+#elif defined(__SSE2__)
+    const __m128i signBit = _mm_set1_epi16((short)0x8000);
+    for (int idx = 0; idx < 64; idx += 16) {
+        __m128i cmpLo = _mm_cmpgt_epi16(_mm_xor_si128(_mm_loadu_si128((const __m128i*)(grayPix + idx)), signBit), _mm_xor_si128(_mm_loadu_si128((const __m128i*)(thrPix + idx)), signBit));
+        __m128i cmpHi = _mm_cmpgt_epi16(_mm_xor_si128(_mm_loadu_si128((const __m128i*)(grayPix + idx + 8)), signBit), _mm_xor_si128(_mm_loadu_si128((const __m128i*)(thrPix + idx + 8)), signBit));
+        word |= (uint64_t)_mm_movemask_epi8(_mm_packs_epi16(cmpLo, cmpHi)) << idx;
+    }
+#else
+    for (int idx = 0; idx < 64; idx++) word |= (uint64_t)(grayPix[idx] > thrPix[idx]) << idx;
+#endif
+    return word;
+}
+static uint64_t ditherWord(const float* grayPix, const float* thrPix) {
+    uint64_t word = 0;
+#if defined(__AVX__)
+    for (int idx = 0; idx < 64; idx += 8)
+        word |= (uint64_t)_mm256_movemask_ps(_mm256_cmp_ps(_mm256_loadu_ps(grayPix + idx), _mm256_loadu_ps(thrPix + idx), _CMP_GT_OQ)) << idx;
+#elif defined(__SSE2__)
+    for (int idx = 0; idx < 64; idx += 4)
+        word |= (uint64_t)_mm_movemask_ps(_mm_cmpgt_ps(_mm_loadu_ps(grayPix + idx), _mm_loadu_ps(thrPix + idx))) << idx;
+#else
+    for (int idx = 0; idx < 64; idx++) word |= (uint64_t)(grayPix[idx] > thrPix[idx]) << idx;
+#endif
+    return word;
+}
+
+// Dithering: Threshold every Row against its expanded Tile Row
+template <typename T>
+static void ditherRows(const cv::Mat_<T> grayImg, const cv::Mat_<T> thrTile, BitPlane& resBin, int rowOff) {
+    int height = grayImg.rows, width = grayImg.cols, fullWords = width / 64;
+
+    // 1. Expand the Tile Rows to the Image Width, so a Row compares against one contiguous Threshold Row
+    cv::Mat_<T> thrRows(thrTile.rows, width);
+    for (int row = 0; row < thrTile.rows; row++)
+        for (int col = 0; col < width; col++) thrRows(row, col) = thrTile(row, col % thrTile.cols);
+
+    // 2. Compare whole Words with SIMD, the partial last Word per Pixel
+    resBin = BitPlane(height, width);
+    cv::parallel_for_(cv::Range(0, height), [&](const cv::Range& range) {
+        for (int row = range.start; row < range.end; row++) {
+            const T *grayRow = grayImg[row], *thrRow = thrRows[(row + rowOff) % thrTile.rows];
+            uint64_t* bitRow = resBin.rowPtr(row);
+            for (int wdx = 0; wdx < fullWords; wdx++) bitRow[wdx] = ditherWord(grayRow + wdx * 64, thrRow + wdx * 64);
+            for (int col = fullWords * 64; col < width; col++) bitRow[col >> 6] |= (uint64_t)(grayRow[col] > thrRow[col]) << (col & 63);
+        }
+    }, cv::getNumThreads() * 4);
+}
+void ditherRows(const cv::Mat grayImg, const cv::Mat thrTile, BitPlane& resBin, int rowOff) {
+    if (grayImg.depth() == CV_8U) ditherRows<uint8_t>(grayImg, thrTile, resBin, rowOff);
+    if (grayImg.depth() == CV_16U) ditherRows<uint16_t>(grayImg, thrTile, resBin, rowOff);
+    if (grayImg.depth() == CV_32F) ditherRows<float>(grayImg, thrTile, resBin, rowOff);
+}
+
+// Multi-level: Bits per Pixel of a Level Count (2, 4, 16), 0 if not supported
+int levelBits(int levels) {
+    if (levels == 2) return 1;
+    if (levels == 4) return 2;
+    if (levels == 16) return 4;
+    std::cerr << "Gray Level Count " << levels << " is not Supported!" << std::endl;
+    return 0;
+}
+
+// Dithering: Multi-level, a Pixel takes the Level below its scaled Gray, or the one above if the Fraction passes its Threshold
+void ditherLevels(const cv::Mat1f grayImg, const cv::Mat1f thrTile, FrameBuffer& frame, int levels) {
+    int height = grayImg.rows, width = grayImg.cols, bpp = levelBits(levels), perByte = 8 / bpp;
+    float maxLevel = (float)(levels - 1);
+
+    // 1. Expand the Tile Rows to the Image Width & the Bit Position of every Slot of a Byte
+    cv::Mat1f thrRows(thrTile.rows, width);
+    for (int row = 0; row < thrTile.rows; row++)
+        for (int col = 0; col < width; col++) thrRows(row, col) = thrTile(row, col % thrTile.cols);
+    frame = FrameBuffer(height, width, bpp, frame.msbFirst());
+    int slotShift[8];
+    for (int slot = 0; slot < perByte; slot++) slotShift[slot] = frame.msbFirst() ? 8 - bpp * (slot + 1) : bpp * slot;
+
+    // 2. Levels of a Row (Branch-free, vectorizable), then pack them Byte by Byte
+    cv::parallel_for_(cv::Range(0, height), [&](const cv::Range& range) {
+        std::vector<uint8_t> lvlRow(frame.rowBytes() * perByte, 0);  // Padding Pixels stay Level 0
+        for (int row = range.start; row < range.end; row++) {
+            const float *grayRow = grayImg[row], *thrRow = thrRows[row % thrTile.rows];
+            for (int col = 0; col < width; col++) {
+                float scaled = std::min(1.0f, std::max(0.0f, grayRow[col])) * maxLevel;
+                int level = (int)scaled;
+                lvlRow[col] = std::min(levels - 1, level + (scaled - level > thrRow[col]));
+            }
+            uint8_t* byteRow = frame.rowPtr(row);
+            for (int bdx = 0; bdx < frame.rowBytes(); bdx++) {
+                uint8_t byte = 0;
+                for (int slot = 0; slot < perByte; slot++) byte |= lvlRow[bdx * perByte + slot] << slotShift[slot];
+                byteRow[bdx] = byte;
+            }
+        }
+    }, cv::getNumThreads() * 4);
+}
+
+// DBS: Min Delta Error among the 8 Swaps (nbRow/nbCol Order) & the Toggle (Index 8) of a gathered 3x3 Neighborhood
+// ... Branch-free, SIMD if available, -1 if no Candidate decreases the Error
+int minCandidate(const double* resNb, const double* cpeNb, const double* cppNb, double resCent, double cpeCent, double cppCent, float& minErr) {
+    double togCent = (int)resCent == 0 ? 1 : -1;
+    alignas(32) double togNb[8], deltaNb[8];
+    for (int idx = 0; idx < 8; idx++) togNb[idx] = (int)resNb[idx] == 0 ? 1 : -1;
+    double swapBase = 2.0 * cppCent + 2.0 * togCent * cpeCent;  // Shared by all Swaps
+    double togErr = 1.0 * cppCent + 2.0 * togCent * cpeCent;    // Toggle Condition
+
+    // 1. Swap Condition: base + 2 a1 c_pe(q) + 2 a0 a1 c_pp(p - q), 0 (Never Taken) if the Neighbor has the same Value
+#if defined(__AVX__)
+    for (int idx = 0; idx < 8; idx += 4) {
+        __m256d togVec = _mm256_load_pd(togNb + idx);
+        __m256d delta = _mm256_add_pd(_mm256_set1_pd(swapBase), _mm256_mul_pd(_mm256_mul_pd(_mm256_set1_pd(2.0), togVec), _mm256_loadu_pd(cpeNb + idx)));
+        delta = _mm256_add_pd(delta, _mm256_mul_pd(_mm256_mul_pd(_mm256_set1_pd(2.0 * togCent), togVec), _mm256_loadu_pd(cppNb + idx)));
+        __m256d valid = _mm256_cmp_pd(_mm256_loadu_pd(resNb + idx), _mm256_set1_pd(resCent), _CMP_NEQ_UQ);
+        _mm256_store_pd(deltaNb + idx, _mm256_and_pd(delta, valid));
+    }
+#elif defined(__SSE2__)
+    for (int idx = 0; idx < 8; idx += 2) {
+        __m128d togVec = _mm_load_pd(togNb + idx);
+        __m128d delta = _mm_add_pd(_mm_set1_pd(swapBase), _mm_mul_pd(_mm_mul_pd(_mm_set1_pd(2.0), togVec), _mm_loadu_pd(cpeNb + idx)));
+        delta = _mm_add_pd(delta, _mm_mul_pd(_mm_mul_pd(_mm_set1_pd(2.0 * togCent), togVec), _mm_loadu_pd(cppNb + idx)));
+        __m128d valid = _mm_cmpneq_pd(_mm_loadu_pd(resNb + idx), _mm_set1_pd(resCent));
+        _mm_store_pd(deltaNb + idx, _mm_and_pd(delta, valid));
+    }
+#else
+    for (int idx = 0; idx < 8; idx++) {
+        double delta = swapBase + 2.0 * togNb[idx] * cpeNb[idx] + 2.0 * togCent * togNb[idx] * cppNb[idx];
+        deltaNb[idx] = resNb[idx] != resCent ? delta : 0.0;
+    }
+#endif
+
+    // 2. Swaps in Raster Order, then the Toggle
+    int minIdx = -1;
+    for (int idx = 0; idx < 8; idx++)
+        if ((float)deltaNb[idx] < minErr) minErr = deltaNb[idx], minIdx = idx;
+    if ((float)togErr < minErr) minErr = togErr, minIdx = 8;
+    return minIdx;
+}
+
+// DBS: Apply the Swap/Toggle to the Result, Low-pass Error & c_pe Images
+void applySwap(cv::Mat1f& resImg, cv::Mat1f& lpErrImg, cv::Mat1f& cpeImg, const cv::Mat1f cppMat, cv::Vec2i posPix, cv::Vec2i posSwap, int kSize, const cv::Mat1f gskMat) {
+    cv::Vec3i newCent = {posPix[0], posPix[1], (int)resImg(posPix[0], posPix[1]) == 0 ? 1 : -1};
+    cv::Vec3i newSwap = {posSwap[0], posSwap[1], (int)resImg(posSwap[0], posSwap[1]) == 0 ? 1 : -1};
+    if (newCent[0] == newSwap[0] && newCent[1] == newSwap[1]) newSwap[2] = 0;
+    resImg(newCent[0], newCent[1]) += newCent[2], resImg(newSwap[0], newSwap[1]) += newSwap[2];
+    altLpErr(lpErrImg, newCent, kSize, gskMat), altLpErr(lpErrImg, newSwap, kSize, gskMat);
+    altCpe(cpeImg, cppMat, newCent, kSize), altCpe(cpeImg, cppMat, newSwap, kSize);
+    return;
+}
+
+// C-DBS: BGR to Opponent Space Matrix, Identity or the OKLab Jacobian at Neutral Gray (up to Scale)
+// ... At Gray, LMS is Equal in all Cones, so the Cube Root of OKLab only Scales the linear Chain
+cv::Mat1f getOppMat(bool perceptual) {
+    if (!perceptual) return cv::Mat1f::eye(3, 3);
+    cv::Mat1f oppMat = colorconvert::_cvtMat_LMS2OKL[0] * colorconvert::_cvtMat_XYZ2LMS[0] * colorconvert::_cvtMat_RGB2XYZ[0];
+    cv::flip(oppMat, oppMat, 1);  // RGB Columns to BGR Columns
+    return oppMat;
+}
+
+// C-DBS: minCandidate on the 3 Channels of a gathered pixel-interleaved 3x3 Neighborhood (Channel ch of Neighbor idx at idx * 3 + ch)
+// ... Same Arithmetic per Channel as minCandidate, the Index of a Channel is -1 if no Candidate decreases its Error
+cv::Vec3i minCandidate(const double* resNb, const double* cpeNb, const double* cppNb, cv::Vec3d resCent, cv::Vec3d cpeCent, cv::Vec3d cppCent, cv::Vec3f& minErr) {
+    alignas(32) double baseNb[24], togNb[24], pairNb[24], deltaNb[24];
+    cv::Vec3d togCent, togErr;
+    for (int ch = 0; ch < 3; ch++) {
+        togCent[ch] = (int)resCent[ch] == 0 ? 1 : -1;
+        togErr[ch] = 1.0 * cppCent[ch] + 2.0 * togCent[ch] * cpeCent[ch];  // Toggle Condition
+    }
+    for (int idx = 0; idx < 8; idx++)
+        for (int ch = 0; ch < 3; ch++) {
+            togNb[idx * 3 + ch] = (int)resNb[idx * 3 + ch] == 0 ? 1 : -1;
+            baseNb[idx * 3 + ch] = 2.0 * cppCent[ch] + 2.0 * togCent[ch] * cpeCent[ch];  // Shared by all Swaps of the Channel
+            pairNb[idx * 3 + ch] = 2.0 * togCent[ch] * togNb[idx * 3 + ch];              // Negative iff the Neighbor differs
+        }
+
+    // 1. Swap Condition of all Channels: base + 2 a1 c_pe(q) + 2 a0 a1 c_pp(p - q), 0 (Never Taken) if the Neighbor has the same Value
+#if defined(__AVX__)
+    for (int idx = 0; idx < 24; idx += 4) {
+        __m256d pairVec = _mm256_load_pd(pairNb + idx);
+        __m256d delta = _mm256_add_pd(_mm256_load_pd(baseNb + idx), _mm256_mul_pd(_mm256_mul_pd(_mm256_set1_pd(2.0), _mm256_load_pd(togNb + idx)), _mm256_loadu_pd(cpeNb + idx)));
+        delta = _mm256_add_pd(delta, _mm256_mul_pd(pairVec, _mm256_loadu_pd(cppNb + idx)));
+        _mm256_store_pd(deltaNb + idx, _mm256_and_pd(delta, _mm256_cmp_pd(pairVec, _mm256_setzero_pd(), _CMP_LT_OQ)));
+    }
+#elif defined(__SSE2__)
+    for (int idx = 0; idx < 24; idx += 2) {
+        __m128d pairVec = _mm_load_pd(pairNb + idx);
+        __m128d delta = _mm_add_pd(_mm_load_pd(baseNb + idx), _mm_mul_pd(_mm_mul_pd(_mm_set1_pd(2.0), _mm_load_pd(togNb + idx)), _mm_loadu_pd(cpeNb + idx)));
+        delta = _mm_add_pd(delta, _mm_mul_pd(pairVec, _mm_loadu_pd(cppNb + idx)));
+        _mm_store_pd(deltaNb + idx, _mm_and_pd(delta, _mm_cmplt_pd(pairVec, _mm_setzero_pd())));
+    }
+#else
+    for (int idx = 0; idx < 24; idx++) {
+        double delta = baseNb[idx] + 2.0 * togNb[idx] * cpeNb[idx] + pairNb[idx] * cppNb[idx];
+        deltaNb[idx] = pairNb[idx] < 0 ? delta : 0.0;
+    }
+#endif
+
+    // 2. Swaps in Raster Order, then the Toggle, for every Channel
+    cv::Vec3i minIdx = {-1, -1, -1};
+    minErr = {0, 0, 0};
+    for (int ch = 0; ch < 3; ch++) {
+        for (int idx = 0; idx < 8; idx++)
+            if ((float)deltaNb[idx * 3 + ch] < minErr[ch]) minErr[ch] = deltaNb[idx * 3 + ch], minIdx[ch] = idx;
+        if ((float)togErr[ch] < minErr[ch]) minErr[ch] = togErr[ch], minIdx[ch] = 8;
+    }
+    return minIdx;
+}
+
+// C-DBS: Search the Swap/Toggle of all 3 Channels of an Inner Pixel in one Walk of its 3x3 Neighborhood
+// ... Every Channel picks its Candidate on the Planes before the Visit, the Cross Terms 2 w_ab c_pp between the Channels
+// ... (0 without perceptual) complete the joint Delta Error, which falls back to the best single Channel if they eat the Gain
+std::pair<float, cv::Vec3i> searchPixInner(const cv::Mat3f resImg, const cv::Mat3f cpeImg, const cv::Mat1f cppMat, cv::Vec2i posPix, const cv::Mat1f wgtMat) {
+    int row = posPix[0], col = posPix[1], reach = cppMat.rows / 2;
+    cv::Vec3d cppWgt = {wgtMat(0, 0), wgtMat(1, 1), wgtMat(2, 2)};  // Squared Response of each Channel in the Opponent Space
+    alignas(32) double resNb[24], cpeNb[24], cppNb[24];
+
+    // 1. Load the 3x3 Neighborhood once, each of its Rows is 9 adjacent Floats (nbRow/nbCol Order skips the Center)
+    for (int rdx = -1, idx = 0; rdx <= 1; rdx++) {
+        const float *resRow = resImg.ptr<float>(row + rdx) + 3 * (col - 1), *cpeRow = cpeImg.ptr<float>(row + rdx) + 3 * (col - 1);
+        for (int cdx = 0; cdx < 3; cdx++) {
+            if (rdx == 0 && cdx == 1) continue;
+            double cppVal = cppMat(reach - rdx, reach + 1 - cdx);
+            for (int ch = 0; ch < 3; ch++) resNb[idx * 3 + ch] = resRow[cdx * 3 + ch], cpeNb[idx * 3 + ch] = cpeRow[cdx * 3 + ch], cppNb[idx * 3 + ch] = cppWgt[ch] * cppVal;
+            idx++;
+        }
+    }
+    cv::Vec3d resCent, cpeCent, cppCent;
+    for (int ch = 0; ch < 3; ch++) resCent[ch] = resImg(row, col)[ch], cpeCent[ch] = cpeImg(row, col)[ch], cppCent[ch] = cppWgt[ch] * cppMat(reach, reach);
+
+    // 2. Find the Min Error Candidate of every Channel
+    cv::Vec3f chErr;
+    cv::Vec3i minIdx = minCandidate(resNb, cpeNb, cppNb, resCent, cpeCent, cppCent, chErr);
+    float minErr = chErr[0] + chErr[1] + chErr[2];
+    if (wgtMat(0, 1) == 0 && wgtMat(0, 2) == 0 && wgtMat(1, 2) == 0) return {minErr, minIdx};  // Channels do not interact
+
+    // 3. Cross Terms of every Pair of changing Channels, the Pixels are within 2 of each other
+    cv::Vec3i togPix[3][2];  // (Row Offset, Col Offset, Toggle) of the Center & the Partner, Toggle 0 if unused
+    for (int ch = 0; ch < 3; ch++) {
+        int togCent = minIdx[ch] == -1 ? 0 : (int)resCent[ch] == 0 ? 1 : -1;
+        togPix[ch][0] = {0, 0, togCent};
+        togPix[ch][1] = minIdx[ch] < 0 || minIdx[ch] == 8 ? cv::Vec3i(0, 0, 0) : cv::Vec3i(nbRow[minIdx[ch]], nbCol[minIdx[ch]], -togCent);
+    }
+    double crossErr = 0;
+    for (int chA = 0; chA < 3; chA++)
+        for (int chB = chA + 1; chB < 3; chB++)
+            for (const cv::Vec3i& pixA : togPix[chA])
+                for (const cv::Vec3i& pixB : togPix[chB]) {
+                    int dRow = pixA[0] - pixB[0], dCol = pixA[1] - pixB[1];
+                    if (pixA[2] == 0 || pixB[2] == 0 || std::abs(dRow) > reach || std::abs(dCol) > reach) continue;
+                    crossErr += 2.0 * wgtMat(chA, chB) * pixA[2] * pixB[2] * cppMat(dRow + reach, dCol + reach);
+                }
+    minErr += crossErr;
+
+    // 4. Keep only the best Channel if it alone decreases the Error more
+    int bestCh = chErr[0] <= chErr[1] && chErr[0] <= chErr[2] ? 0 : chErr[1] <= chErr[2] ? 1 : 2;
+    if (minErr < chErr[bestCh]) return {minErr, minIdx};
+    for (int ch = 0; ch < 3; ch++) minIdx[ch] = ch == bestCh ? minIdx[ch] : -1;
+    return {chErr[bestCh], minIdx};
+}
+
+// C-DBS: Search the Swap/Toggle of one Channel with Min Delta Error in the 3x3 Neighborhood of a Border Pixel
+// ... The Error of the Channel reaches every Opponent Plane by its Column of T, its c_pe Lane is already projected by T^T
+std::pair<float, cv::Vec3i> searchPix(const cv::Mat3f resImg, const cv::Mat3f lpErrImg, const cv::Mat3f cpeImg, const cv::Mat1f cppMat, cv::Vec2i posPix, int ch, int kSize, const cv::Mat1f gskMat, const cv::Mat1f oppMat) {
+    int height = resImg.rows, width = resImg.cols, half = kSize / 2, row = posPix[0], col = posPix[1];
+    cv::Vec3f oppVec = {oppMat(0, ch), oppMat(1, ch), oppMat(2, ch)};
+    double oppNorm = oppVec.dot(oppVec);  // Squared Response of the Channel in the Opponent Space
+    float minErr = 0, resCent = resImg(row, col)[ch];
+    cv::Vec3i minIdx = {-1, -1, -1};
+    auto isInner = [&](int pRow, int pCol) { return pRow >= half && pRow < height - half && pCol >= half && pCol < width - half; };
+    auto laneCpe = [&](cv::Vec3i posCent, cv::Vec3i posSwap) {  // deltaCpe on the c_pe Lane of the Channel
+        int reach = cppMat.rows / 2, dRow = posCent[0] - posSwap[0], dCol = posCent[1] - posSwap[1];
+        double deltaErr = (double)(posCent[2] * posCent[2] + posSwap[2] * posSwap[2]) * (oppNorm * cppMat(reach, reach));
+        deltaErr += 2.0 * posCent[2] * cpeImg(posCent[0], posCent[1])[ch];
+        if (posSwap[2] == 0) return (float)deltaErr;  // Toggle Condition
+        deltaErr += 2.0 * posSwap[2] * cpeImg(posSwap[0], posSwap[1])[ch];
+        if (std::abs(dRow) <= reach && std::abs(dCol) <= reach) deltaErr += 2.0 * posCent[2] * posSwap[2] * (oppNorm * cppMat(dRow + reach, dCol + reach));
+        return (float)deltaErr;
+    };
+
+    // 1. Swap Condition, use the Tables if both Footprints are inside the Image, otherwise the Direct Window Sum
+    cv::Vec3i posCent = {row, col, (int)resCent == 0 ? 1 : -1};
+    for (int idx = 0; idx < 8; idx++) {
+        int nRow = row + nbRow[idx], nCol = col + nbCol[idx];
+        if (nRow < 0 || nRow >= height || nCol < 0 || nCol >= width) continue;
+        if (resImg(nRow, nCol)[ch] == resCent) continue;
+        cv::Vec3i posSwap = {nRow, nCol, (int)resImg(nRow, nCol)[ch] == 0 ? 1 : -1};
+        float deltaErr = isInner(row, col) && isInner(nRow, nCol) ? laneCpe(posCent, posSwap) : deltaLpErr(lpErrImg, posCent, posSwap, kSize, gskMat, oppVec);
+        if (deltaErr < minErr) minErr = deltaErr, minIdx[ch] = idx;
+    }
+    // 2. Toggle Condition
+    cv::Vec3i posSwap = {row, col, 0};
+    float deltaErr = isInner(row, col) ? laneCpe(posCent, posSwap) : deltaLpErr(lpErrImg, posCent, posSwap, kSize, gskMat, oppVec);
+    if (deltaErr < minErr) minErr = deltaErr, minIdx[ch] = 8;
+    return {minErr, minIdx};
+}
+
+// C-DBS: Delta Error of a Swap/Toggle of one Channel by the Direct Window Sum over all Opponent Planes (oppVec: its Column of T)
+float deltaLpErr(const cv::Mat3f lpErrImg, cv::Vec3i posCent, cv::Vec3i posSwap, int kSize, const cv::Mat1f gskMat, cv::Vec3f oppVec) {
+    cv::Vec3f deltaErr = {0, 0, 0};
+    int togCent = posCent[2], togSwap = posSwap[2];
+
+    for (int rdx = (-kSize / 2) - 1; rdx <= (kSize / 2) + 1; rdx++)
+        for (int cdx = (-kSize / 2) - 1; cdx <= (kSize / 2) + 1; cdx++) {
+            float smallDeltaE = 0;
+            int pixRow = posCent[0] + rdx, pixCol = posCent[1] + cdx;
+            cv::Vec2i centDist = {rdx + kSize / 2, cdx + kSize / 2},
+                      swapDist = {pixRow - posSwap[0] + kSize / 2, pixCol - posSwap[1] + kSize / 2};
+            if (pixRow < 0 || pixRow >= lpErrImg.rows || pixCol < 0 || pixCol >= lpErrImg.cols) continue;
+            if (centDist[0] >= 0 && centDist[1] >= 0 && centDist[0] < kSize && centDist[1] < kSize)
+                smallDeltaE += gskMat(centDist[0], centDist[1]) * togCent;  // Calculate Small Delta E with Center Pixel
+            if (swapDist[0] >= 0 && swapDist[1] >= 0 && swapDist[0] < kSize && swapDist[1] < kSize)
+                smallDeltaE += gskMat(swapDist[0], swapDist[1]) * togSwap;  // Calculate Small Delta E with Swap Pixel
+            const cv::Vec3f& errPix = lpErrImg(pixRow, pixCol);
+            for (int pln = 0; pln < 3; pln++) {
+                if (oppVec[pln] == 0) continue;  // Plane not reached by the Channel
+                double newErr = smallDeltaE * oppVec[pln] + errPix[pln], oldErr = errPix[pln];
+                deltaErr[pln] += newErr * newErr - oldErr * oldErr;
+            }
+        }
+
+    return deltaErr[0] + deltaErr[1] + deltaErr[2];
+}
+
+// C-DBS: Kernel of every Channel on the pixel-interleaved Planes (Lane pln of Kernel ch is kerMat scaled by mixMat(pln, ch))
+std::vector<cv::Mat3f> getChKers(const cv::Mat1f kerMat, const cv::Mat1f mixMat) {
+    std::vector<cv::Mat3f> chKers;
+    for (int ch = 0; ch < 3; ch++) chKers.push_back(colorconvert::mergeCh({kerMat * mixMat(0, ch), kerMat * mixMat(1, ch), kerMat * mixMat(2, ch)}));
+    return chKers;
+}
+
+// C-DBS: Add the Kernels of the toggled Channels (chTog: +1, -1 or 0) to the Footprint of a Pixel, clipped to margin from the Border
+// ... A clipped Footprint Row is one contiguous Run of Floats on both Sides, so every Channel is a plain vectorizable Add
+void altPlanes(cv::Mat3f& plnImg, cv::Vec2i posPix, const std::vector<cv::Mat3f>& chKers, cv::Vec3f chTog, int margin) {
+    int height = plnImg.rows, width = plnImg.cols, reach = chKers[0].rows / 2;
+    int rowSt = std::max(posPix[0] - reach, margin), rowEd = std::min(posPix[0] + reach, height - 1 - margin);
+    int colSt = std::max(posPix[1] - reach, margin), colEd = std::min(posPix[1] + reach, width - 1 - margin);
+    int runLen = 3 * (colEd - colSt + 1);
+    for (int nRow = rowSt; nRow <= rowEd; nRow++) {
+        float* plnRow = plnImg.ptr<float>(nRow) + 3 * colSt;
+        for (int ch = 0; ch < 3; ch++) {
+            if (chTog[ch] == 0) continue;
+            const float* kerRow = chKers[ch].ptr<float>(nRow - posPix[0] + reach) + 3 * (colSt - posPix[1] + reach);
+            for (int idx = 0; idx < runLen; idx++) plnRow[idx] += kerRow[idx] * chTog[ch];
+        }
+    }
+    return;
+}
+
+// C-DBS: Apply the Swap/Toggle of every Channel (Index as minCandidate, -1 to skip) to the Result, Low-pass Error & c_pe Images
+// ... The Toggles of all Channels at the Center share one Footprint Walk, then every Swap Partner adds its own
+void applySwap(cv::Mat3f& resImg, cv::Mat3f& lpErrImg, cv::Mat3f& cpeImg, cv::Vec2i posPix, cv::Vec3i minIdx, const std::vector<cv::Mat3f>& lpKers, const std::vector<cv::Mat3f>& cpeKers) {
+    int half = lpKers[0].rows / 2;
+    cv::Vec3f& resCent = resImg(posPix[0], posPix[1]);
+    cv::Vec3f togCent = {0, 0, 0};
+
+    // 1. Toggle every changing Channel at the Center & its Partner in the Result
+    for (int ch = 0; ch < 3; ch++) {
+        if (minIdx[ch] == -1) continue;
+        togCent[ch] = (int)resCent[ch] == 0 ? 1 : -1;
+        resCent[ch] += togCent[ch];
+        if (minIdx[ch] < 8) resImg(posPix[0] + nbRow[minIdx[ch]], posPix[1] + nbCol[minIdx[ch]])[ch] -= togCent[ch];
+    }
+
+    // 2. Update the Low-pass Error & c_pe Images (c_pe on Inner Pixels Only)
+    altPlanes(lpErrImg, posPix, lpKers, togCent, 0), altPlanes(cpeImg, posPix, cpeKers, togCent, half);
+    for (int ch = 0; ch < 3; ch++) {
+        if (minIdx[ch] == -1 || minIdx[ch] == 8) continue;
+        cv::Vec2i posSwap = {posPix[0] + nbRow[minIdx[ch]], posPix[1] + nbCol[minIdx[ch]]};
+        cv::Vec3f togSwap = {0, 0, 0};
+        togSwap[ch] = -togCent[ch];
+        altPlanes(lpErrImg, posSwap, lpKers, togSwap, 0), altPlanes(cpeImg, posSwap, cpeKers, togSwap, half);
+    }
+    return;
+}
+
+// DBS: Mark the Pixels whose Swap/Toggle Search reads the Footprint of a changed Pixel as Active
+// ... Pixels after the visiting Pixel (raster order) are still visited in this Pass, the others in the next Pass
+void markActive(cv::Mat1b& curActive, cv::Mat1b& nextActive, cv::Vec2i posPix, cv::Vec2i posVisit, int kSize) {
+    int rowSt = std::max(posPix[0] - kSize, 0), rowEd = std::min(posPix[0] + kSize, curActive.rows - 1);
+    int colSt = std::max(posPix[1] - kSize, 0), colEd = std::min(posPix[1] + kSize, curActive.cols - 1);
+    for (int row = rowSt; row <= rowEd; row++) {
+        int colMid = row < posVisit[0] ? colEd + 1 : row > posVisit[0] ? colSt : std::min(std::max(posVisit[1] + 1, colSt), colEd + 1);
+        std::fill(nextActive.ptr<uchar>(row) + colSt, nextActive.ptr<uchar>(row) + colMid, 1);
+        std::fill(curActive.ptr<uchar>(row) + colMid, curActive.ptr<uchar>(row) + colEd + 1, 1);
+    }
+    return;
 }
 
 // DBS: Visualize Error Image
@@ -0,0 +1,110 @@
+#include "MaskCache.hpp"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <future>
+#include <map>
+#include <mutex>
+#include <random>
+
+#include "Halftone.hpp"
+
+namespace halftone {
+
+std::string maskCacheDir = "data/mask";
+
+namespace {
+const char maskMagic[4] = {'V', 'C', 'M', '1'};  // File Tag & Version
+struct MaskHeader {
+    char magic[4];
+    uint32_t rows, cols;
+};
+
+std::mutex maskMutex;                                       // Guards the Mask Table only, never held while a Mask is made
+std::map<std::string, std::shared_future<cv::Mat1w>> masks;  // Masks loaded or in the making in this Process (Mapped Files stay mapped)
+
+// Map a Mask File read-only, empty if it does not exist or does not fit the Size
+cv::Mat1w mapMask(const std::string& filePath, int blkSize) {
+    int fileDesc = open(filePath.c_str(), O_RDONLY);
+    if (fileDesc < 0) return cv::Mat1w();
+    struct stat fileStat;
+    size_t fileSize = sizeof(MaskHeader) + (size_t)blkSize * blkSize * sizeof(uint16_t);
+    if (fstat(fileDesc, &fileStat) != 0 || (size_t)fileStat.st_size != fileSize) return close(fileDesc), cv::Mat1w();
+
+    void* fileData = mmap(nullptr, fileSize, PROT_READ, MAP_SHARED, fileDesc, 0);
+    close(fileDesc);  // The Mapping holds its own Reference
+    if (fileData == MAP_FAILED) return cv::Mat1w();
+    const MaskHeader* header = (const MaskHeader*)fileData;
+    if (std::memcmp(header->magic, maskMagic, 4) != 0 || header->rows != (uint32_t)blkSize || header->cols != (uint32_t)blkSize)
+        return munmap(fileData, fileSize), cv::Mat1w();
+    return cv::Mat1w(blkSize, blkSize, (uint16_t*)((char*)fileData + sizeof(MaskHeader)));
+}
+
+// Write a Mask File through a temporary File, so a concurrent Reader never maps a partial one
+bool writeMask(const std::string& filePath, const cv::Mat1w& rankImg) {
+    if (system(("mkdir -p " + maskCacheDir).c_str()) != 0) return false;
+    std::string tempPath = filePath + "." + std::to_string(getpid()) + ".tmp";
+    std::ofstream maskFile(tempPath, std::ios::binary);
+    MaskHeader header = {{maskMagic[0], maskMagic[1], maskMagic[2], maskMagic[3]}, (uint32_t)rankImg.rows, (uint32_t)rankImg.cols};
+    maskFile.write((const char*)&header, sizeof(header));
+    for (int row = 0; row < rankImg.rows; row++) maskFile.write((const char*)rankImg.ptr<uint16_t>(row), rankImg.cols * sizeof(uint16_t));
+    maskFile.close();
+    if (!maskFile || std::rename(tempPath.c_str(), filePath.c_str()) != 0) return std::remove(tempPath.c_str()), false;
+    return true;
+}
+}  // namespace
+
+// Void & Cluster Dither Array from the Mask Cache
+cv::Mat1w getVCMask(int blkSize, int kernelSize, float sigma, unsigned seed) {
+    if (blkSize <= 0 || blkSize * blkSize > 65536) {
+        std::cerr << "Mask Size " << blkSize << " does not fit uint16 Ranks!" << std::endl;
+        return cv::Mat1w();
+    }
+    std::string maskName = "VC_" + std::to_string(blkSize) + "_K" + std::to_string(kernelSize) + "_S" + std::to_string(sigma) + "_R" + std::to_string(seed) + ".u16";
+    std::promise<cv::Mat1w> maskPromise;
+    {
+        // 1. Loaded before (or being made) in this Process: wait for it outside the Lock
+        std::unique_lock<std::mutex> maskLock(maskMutex);
+        auto maskIter = masks.find(maskName);
+        if (maskIter != masks.end()) {
+            std::shared_future<cv::Mat1w> maskFuture = maskIter->second;
+            maskLock.unlock();
+            return maskFuture.get();
+        }
+        masks[maskName] = maskPromise.get_future().share();  // Claim the Key, other Callers of it wait on the Future
+    }
+
+    try {
+        // 2. Cached on Disk
+        std::string filePath = maskCacheDir + "/" + maskName;
+        cv::Mat1w rankImg = maskCacheDir.empty() ? cv::Mat1w() : mapMask(filePath, blkSize);
+
+        // 3. Miss: Generate from a seeded Random Pattern, then write through & map the new File
+        if (rankImg.empty()) {
+            std::mt19937 randGen(seed);
+            cv::Mat1f initImg(blkSize, blkSize);
+            for (int row = 0; row < blkSize; row++)
+                for (int col = 0; col < blkSize; col++) initImg(row, col) = (float)(randGen() & 1);
+            VoidCluster(initImg, kernelSize, sigma).convertTo(rankImg, CV_16U);
+            if (!maskCacheDir.empty() && writeMask(filePath, rankImg)) {
+                cv::Mat1w fileImg = mapMask(filePath, blkSize);
+                rankImg = fileImg.empty() ? rankImg : fileImg;
+            }
+        }
+        maskPromise.set_value(rankImg);
+        return rankImg;
+    } catch (...) {  // Release the Waiters & drop the Key, so a later Call tries again
+        maskPromise.set_exception(std::current_exception());
+        std::lock_guard<std::mutex> maskLock(maskMutex);
+        masks.erase(maskName);
+        throw;
+    }
+}
+
+}  // namespace halftone
@@ -45,4 +45,11 @@ double SSIM(const cv::Mat1f testImg, const cv::Mat1f refImg, int kSize, float si
     return cv::mean(ssimMap)[0];
 }
 
+// Measure Perceived Error (Mean Squared Low-pass Error) between Halftone & Reference image
+double HVSErr(const cv::Mat1f hfImg, const cv::Mat1f refImg, int kSize, float sigma) {
+    cv::Mat1f psfMat = halftone::detail::getGSF(kSize, sigma);  // Gaussian PSF Kernel (Same as DBS)
+    cv::Mat1f lpErrImg = filter::plConv(hfImg - refImg, psfMat);
+    return cv::mean(lpErrImg.mul(lpErrImg))[0];
+}
+
 }  // namespace measure
@@ -0,0 +1,112 @@
+#include "Plan.hpp"
+
+#include "Filter.hpp"
+#include "MaskCache.hpp"
+
+namespace halftone {
+
+// Reusable Halftoning Plan: the Tables & Buffers of one Frame Size
+HalftonePlan::HalftonePlan(cv::Size imgSize, Algorithm algo, int kernelSize, float sigma, int iters, int blkSize) : algo(algo), imgSize(imgSize), iters(iters), context(kernelSize, sigma) {
+    // 1. Void & Cluster: Pattern, Ranks, Energy Map & Trees
+    if (algo == PlanVoidCluster) {
+        bkImg.create(imgSize), rankImg.create(imgSize);
+        vcEnergy = detail::VCEnergy(imgSize, context.psfMat);
+        return;
+    }
+
+    // 2. DBS & RTB-DBS: Low-pass Error & c_pe in the Context
+    diffImg.create(imgSize), context.lsErrImg.create(imgSize), context.cpeImg.create(imgSize);
+    if (algo != PlanRTBDBS) return;
+
+    // 3. RTB-DBS: Visiting Order by the Block Map from the Mask Cache (No Sequence if the Block Size is out of Range)
+    cv::Mat1i blkMap;
+    getVCMask(blkSize, kernelSize, sigma).convertTo(blkMap, CV_32S);
+    if (blkMap.empty()) return;
+    blkDim = blkMap.size(), blkSeq.resize(blkMap.rows * blkMap.cols);
+    for (int row = 0; row < blkMap.rows; row++)
+        for (int col = 0; col < blkMap.cols; col++) blkSeq[blkMap(row, col)] = {row, col};
+}
+
+// Halftone a Frame from a given Start
+bool HalftonePlan::execute(const cv::Mat1f grayImg, const cv::Mat1f initImg, cv::Mat1f& resImg) {
+    if (algo == PlanVoidCluster) return execute(grayImg, resImg);  // Void & Cluster has no Start
+    if (grayImg.size() != imgSize || initImg.size() != imgSize) {
+        std::cerr << "Image Size does not fit the Halftone Plan!" << std::endl;
+        return false;
+    }
+    if (algo == PlanRTBDBS && blkSeq.empty()) {
+        std::cerr << "Block Size of the Halftone Plan is out of Range!" << std::endl;
+        return false;
+    }
+    resImg.create(imgSize);
+    initImg.copyTo(resImg);
+    runDBS(grayImg, resImg);
+    return true;
+}
+
+// Halftone a Frame from a random Start (DBS & RTB-DBS) or rank a Pattern (Void & Cluster)
+bool HalftonePlan::execute(const cv::Mat1f grayImg, cv::Mat1f& resImg) {
+    int height = imgSize.height, width = imgSize.width;
+    if (grayImg.size() != imgSize) {
+        std::cerr << "Image Size does not fit the Halftone Plan!" << std::endl;
+        return false;
+    }
+    if (algo == PlanRTBDBS && blkSeq.empty()) {
+        std::cerr << "Block Size of the Halftone Plan is out of Range!" << std::endl;
+        return false;
+    }
+    resImg.create(imgSize);
+
+    // 1. Void & Cluster: the three Phases on the Plan Buffers
+    if (algo == PlanVoidCluster) {
+        grayImg.copyTo(bkImg);
+        detail::VCP1(bkImg, rankImg, vcEnergy);  // Rank the Cluster Part
+        detail::VCP2(bkImg, rankImg, vcEnergy);  // Rank the Void Part
+        detail::VCP3(bkImg, rankImg, vcEnergy);  // Rank the Cluster Part
+        for (int row = 0; row < height; row++)
+            for (int col = 0; col < width; col++) resImg(row, col) = rankImg(row, col);
+        return true;
+    }
+
+    // 2. DBS & RTB-DBS: Random Start (Same Sequence as getRandBin)
+    for (int row = 0; row < height; row++)
+        for (int col = 0; col < width; col++) resImg(row, col) = (rand() % 2 == 0) ? 0 : 1;
+    runDBS(grayImg, resImg);
+    return true;
+}
+
+// DBS or RTB-DBS Passes from the Start in resImg
+void HalftonePlan::runDBS(const cv::Mat1f grayImg, cv::Mat1f& resImg) {
+    int height = imgSize.height, width = imgSize.width, kernelSize = context.kSize;
+    const cv::Mat1f psfMat = context.psfMat, cppMat = context.cppMat;  // Gaussian PSF & Autocorrelation
+    auto visitPix = [&](int row, int col) {                            // Search & apply the best Swap/Toggle of a Pixel
+        float minErr = 0;
+        cv::Vec2i minPos = {-1, -1};
+        std::tie(minErr, minPos) = detail::searchPix(resImg, context.lsErrImg, context.cpeImg, cppMat, {row, col}, kernelSize, psfMat);
+        if (minPos[0] == -1 || minPos[1] == -1) return;
+        detail::applySwap(resImg, context.lsErrImg, context.cpeImg, cppMat, {row, col}, minPos, kernelSize, psfMat);
+    };
+
+    // 1. Low-pass Error & c_pe of the Start, straight into the Plan Buffers
+    for (int row = 0; row < height; row++)
+        for (int col = 0; col < width; col++) diffImg(row, col) = resImg(row, col) - grayImg(row, col);
+    filter::plConv(diffImg, psfMat, context.lsErrImg);         // Low-pass Error Image
+    detail::getCPE(context.lsErrImg, psfMat, context.cpeImg);  // PSF & Low-pass Error Cross-correlation
+
+    // 2. DBS Halftoning Iteration: Raster Order, or Block by Block in the Order of the Block Map
+    for (int iter = 0; iter < iters; iter++) {
+        if (algo == PlanDBS) {
+            for (int row = 0; row < height; row++)
+                for (int col = 0; col < width; col++) visitPix(row, col);
+            continue;
+        }
+        for (int blkR = 0; blkR < (height + blkDim.height - 1) / blkDim.height; blkR++)
+            for (int blkC = 0; blkC < (width + blkDim.width - 1) / blkDim.width; blkC++)
+                for (cv::Vec2i workPos : blkSeq) {
+                    int row = blkR * blkDim.height + workPos[0], col = blkC * blkDim.width + workPos[1];
+                    if (row < height && col < width) visitPix(row, col);  // Partial Blocks at the Edge
+                }
+    }
+}
+
+}  // namespace halftone
@@ -0,0 +1,151 @@
+#include "Sequence.hpp"
+
+#include "Filter.hpp"
+#include "Halftone.hpp"
+
+namespace halftone {
+
+SeqDBS::SeqDBS(int kernelSize, float sigma, float threshold, int maxIters) : kSize(kernelSize), maxIters(maxIters), sigma(sigma), threshold(threshold) {
+    psfMat = detail::getGSF(kSize, sigma);  // Gaussian PSF Kernel
+    cppMat = detail::getCPP(psfMat);        // PSF Autocorrelation
+}
+
+// Random Halftone & full State for a new Size (Same Start as ADBS)
+void SeqDBS::reset(const cv::Mat1f grayImg) {
+    refImg = grayImg.clone(), resImg = getRandBin(cv::Vec2i(grayImg.rows, grayImg.cols));
+    lsErrImg = filter::plConv(resImg - refImg, psfMat);  // Low-pass Error Image
+    cpeImg = detail::getCPE(lsErrImg, psfMat);           // PSF & Low-pass Error Cross-correlation
+    curActive = cv::Mat1b(grayImg.size(), 1), nextActive = cv::Mat1b(grayImg.size(), 0);
+}
+
+// Halftone the next Frame of the Sequence
+cv::Rect SeqDBS::next(const cv::Mat1f grayImg) {
+    int height = grayImg.rows, width = grayImg.cols;
+    cv::Rect fullRect(0, 0, width, height), curRect;  // Bounding Box of the Active Pixels
+    dirtyRect = cv::Rect(), changedCount = 0, visitCount = 0;
+
+    // 1. New Size: start over with every Pixel active
+    // 2. Same Size: fold the changed Pixels into the Low-pass Error & c_pe (e = h * (b - g), so -delta per Footprint)
+    if (resImg.empty() || resImg.size() != grayImg.size()) {
+        reset(grayImg);
+        curRect = fullRect, changedCount = height * width;
+    } else {
+        for (int row = 0; row < height; row++) {
+            const float* grayRow = grayImg.ptr<float>(row);
+            float* refRow = refImg.ptr<float>(row);
+            for (int col = 0; col < width; col++) {
+                float deltaVal = grayRow[col] - refRow[col];
+                if (std::abs(deltaVal) <= threshold) continue;
+                detail::altLpErr(lsErrImg, {row, col, 1}, kSize, psfMat, -deltaVal);
+                detail::altCpe(cpeImg, cppMat, {row, col, 1}, kSize, -deltaVal);
+                refRow[col] = grayRow[col], changedCount++;
+                detail::markActive(curActive, nextActive, {row, col}, {-1, -1}, kSize);  // Before every Visit: all into this Pass
+                curRect |= cv::Rect(col - kSize, row - kSize, 2 * kSize + 1, 2 * kSize + 1) & fullRect;
+            }
+        }
+    }
+
+    // 3. A-DBS from the kept Halftone, only inside the Box of the Active Pixels
+    visitCount = detail::activeDBS(resImg, lsErrImg, cpeImg, cppMat, curActive, nextActive, curRect, fullRect, kSize, psfMat, maxIters, dirtyRect);
+    return dirtyRect;
+}
+
+// Region of Interest Direct Binary Search (DBS) Halftoning
+std::vector<cv::Rect> RegionDBS(const cv::Mat1f grayImg, BitPlane& resBin, const std::vector<cv::Rect>& dirtyRects, int kernelSize, float sigma, int maxIters) {
+    std::vector<cv::Rect> doneRects;  // Bounding Boxes of the toggled Pixels
+    if (resBin.rows() != grayImg.rows || resBin.cols() != grayImg.cols) {
+        std::cerr << "Previous Frame does not fit the Image Size!" << std::endl;
+        return doneRects;
+    }
+    cv::Rect fullRect(0, 0, grayImg.cols, grayImg.rows);
+    cv::Mat1f psfMat = detail::getGSF(kernelSize, sigma);  // Gaussian PSF Kernel
+    cv::Mat1f cppMat = detail::getCPP(psfMat);             // PSF Autocorrelation
+    int halo = kernelSize + 1;                             // Halo: c_pe is exact 1 Pixel around the searched Region
+
+    for (cv::Rect dirtyRect : dirtyRects) {
+        // 1. Searched Region: the Rectangle & every Pixel whose Search reads its c_pe Footprint, then the Window with the Halo
+        cv::Rect srchRect = cv::Rect(dirtyRect.x - kernelSize, dirtyRect.y - kernelSize, dirtyRect.width + 2 * kernelSize, dirtyRect.height + 2 * kernelSize) & fullRect;
+        cv::Rect winRect = cv::Rect(srchRect.x - halo, srchRect.y - halo, srchRect.width + 2 * halo, srchRect.height + 2 * halo) & fullRect;
+        if (dirtyRect.empty() || srchRect.empty()) continue;
+
+        // 2. Copy out the Window from the previous Frame, build the Low-pass Error & c_pe against the new Gray Image
+        cv::Mat1f resWin(winRect.size()), oldWin;
+        for (int row = 0; row < winRect.height; row++)
+            for (int col = 0; col < winRect.width; col++) resWin(row, col) = resBin.get(winRect.y + row, winRect.x + col);
+        oldWin = resWin.clone();
+        cv::Mat1f lsErrWin = filter::plConv(resWin - grayImg(winRect), psfMat);  // Low-pass Error Image
+        cv::Mat1f cpeWin = detail::getCPE(lsErrWin, psfMat);                     // PSF & Low-pass Error Cross-correlation
+
+        // 3. A-DBS from the previous Bits, Seams blend as the Error across them counts the fixed Bits outside
+        cv::Rect actRect = srchRect - winRect.tl(), togRect;
+        cv::Mat1b curActive = cv::Mat1b::zeros(winRect.size()), nextActive = cv::Mat1b::zeros(winRect.size());
+        curActive(actRect).setTo(1);
+        detail::activeDBS(resWin, lsErrWin, cpeWin, cppMat, curActive, nextActive, actRect, actRect, kernelSize, psfMat, maxIters, togRect);
+        if (togRect.empty()) continue;
+
+        // 4. Write back the toggled Pixels & keep the tight Box of the ones that differ from the previous Frame
+        cv::Rect tightRect;
+        for (int row = togRect.y; row < togRect.y + togRect.height; row++)
+            for (int col = togRect.x; col < togRect.x + togRect.width; col++) {
+                if (resWin(row, col) == oldWin(row, col)) continue;
+                resBin.flip(winRect.y + row, winRect.x + col);
+                tightRect |= cv::Rect(winRect.x + col, winRect.y + row, 1, 1);
+            }
+        if (!tightRect.empty()) doneRects.push_back(tightRect);
+    }
+
+    // 5. Merge overlapping Boxes, so no Area is refreshed twice
+    for (bool isMerged = true; isMerged;) {
+        isMerged = false;
+        for (int idx = 0; idx < doneRects.size() && !isMerged; idx++)
+            for (int jdx = idx + 1; jdx < doneRects.size() && !isMerged; jdx++)
+                if (!(doneRects[idx] & doneRects[jdx]).empty())
+                    doneRects[idx] |= doneRects[jdx], doneRects.erase(doneRects.begin() + jdx), isMerged = true;
+    }
+    return doneRects;
+}
+
+}  // namespace halftone
+
+namespace halftone::detail {  // Detail Functions
+
+// DBS: A-DBS over the Active Pixels inside searchRect, starting from the Box curRect (Marks outside searchRect are
+// ... left as they are), returns the Number of Searches & grows dirtyRect by every toggled Pixel
+int activeDBS(cv::Mat1f& resImg, cv::Mat1f& lpErrImg, cv::Mat1f& cpeImg, const cv::Mat1f cppMat, cv::Mat1b& curActive, cv::Mat1b& nextActive, cv::Rect curRect, cv::Rect searchRect, int kSize, const cv::Mat1f gskMat, int maxIters, cv::Rect& dirtyRect) {
+    cv::Rect fullRect(0, 0, resImg.cols, resImg.rows), nextRect;  // Bounding Box of the Active Pixels of the next Iteration
+    int visitCount = 0;
+    auto markPix = [&](cv::Vec2i posPix, cv::Vec2i posVisit) {  // Mark the Neighborhood & grow both Boxes
+        markActive(curActive, nextActive, posPix, posVisit, kSize);
+        cv::Rect markRect = cv::Rect(posPix[1] - kSize, posPix[0] - kSize, 2 * kSize + 1, 2 * kSize + 1) & searchRect;
+        curRect |= markRect, nextRect |= markRect;
+    };
+    curRect &= searchRect;
+
+    for (int iter = 0; iter < maxIters && !curRect.empty(); iter++) {
+        for (int row = curRect.y; row < curRect.y + curRect.height; row++) {  // The Box may grow while scanning
+            uchar* activeRow = curActive.ptr<uchar>(row);
+            for (int col = curRect.x; col < curRect.x + curRect.width; col++) {
+                if (!activeRow[col]) continue;
+                activeRow[col] = 0, visitCount++;
+
+                // For Every Pixel in the Kernel, Calculate whether to Swap/Toggle or Not by Min Error
+                float minErr = 0;
+                cv::Vec2i minPos = {-1, -1};
+                std::tie(minErr, minPos) = searchPix(resImg, lpErrImg, cpeImg, cppMat, {row, col}, kSize, gskMat);
+                if (minPos[0] == -1 || minPos[1] == -1) continue;
+
+                // Update the Result Image, Low-pass Error Image & Cross-correlation Image
+                applySwap(resImg, lpErrImg, cpeImg, cppMat, {row, col}, minPos, kSize, gskMat);
+                markPix({row, col}, {row, col}), markPix(minPos, {row, col});
+                dirtyRect |= cv::Rect(col, row, 1, 1) | cv::Rect(minPos[1], minPos[0], 1, 1);
+            }
+        }
+        // Swap the Active Set for the next Iteration
+        std::swap(curActive, nextActive);
+        curRect = !nextRect.empty() && cv::countNonZero(curActive(nextRect)) > 0 ? nextRect : cv::Rect(), nextRect = cv::Rect();
+    }
+    if (!curRect.empty()) curActive(curRect).setTo(0);  // Out of Iterations: drop the Rest
+    return visitCount;
+}
+
+}  // namespace halftone::detail
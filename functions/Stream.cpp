@@ -0,0 +1,175 @@
+#include "Stream.hpp"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include <cstdio>
+
+#include "Halftone.hpp"
+
+namespace halftone {
+
+std::string tileWorkDir = "data/tile";
+
+namespace {
+// Backing File mapped read-write, unmapped when it goes out of Scope
+struct BackingMap {
+    void* data = nullptr;
+    size_t size = 0;
+    BackingMap(const std::string& fileName, size_t fileSize);
+    ~BackingMap() {
+        if (data) munmap(data, size);
+    }
+    void dropRows(size_t rowBytes, int rowSt, int rowEd);  // Release the Pages of Rows [rowSt, rowEd), the File keeps them
+};
+
+// Create the File & unlink it at once, so it lives exactly as long as the Mapping
+BackingMap::BackingMap(const std::string& fileName, size_t fileSize) : size(fileSize) {
+    if (system(("mkdir -p " + tileWorkDir).c_str()) != 0) return;
+    std::string filePath = tileWorkDir + "/" + fileName + "." + std::to_string(getpid()) + ".tmp";
+    int fileDesc = open(filePath.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0600);
+    if (fileDesc < 0) return;
+    std::remove(filePath.c_str());
+    void* fileData = ftruncate(fileDesc, fileSize) == 0 ? mmap(nullptr, fileSize, PROT_READ | PROT_WRITE, MAP_SHARED, fileDesc, 0) : MAP_FAILED;
+    close(fileDesc);  // The Mapping holds its own Reference
+    data = fileData == MAP_FAILED ? nullptr : fileData;
+}
+
+void BackingMap::dropRows(size_t rowBytes, int rowSt, int rowEd) {
+    size_t pageSize = sysconf(_SC_PAGESIZE);
+    size_t byteSt = (rowSt * rowBytes + pageSize - 1) / pageSize * pageSize, byteEd = std::min(rowEd * rowBytes, size) / pageSize * pageSize;
+    if (byteSt < byteEd) madvise((char*)data + byteSt, byteEd - byteSt, MADV_DONTNEED);
+}
+}  // namespace
+
+// Streaming Halftone by Dithering (Bayer)
+bool StreamDither(cv::Size imgSize, int stripRows, int kernelSize, StripReader reader, StripWriter writer) {
+    cv::Mat1f thrTile = detail::bayerTile(kernelSize);
+    if (thrTile.empty()) return false;
+    return StreamDither(imgSize, stripRows, thrTile, reader, writer);
+}
+
+// Streaming Halftone by Dithering (Tiled Threshold Map, the Tile Row follows the Image Row)
+bool StreamDither(cv::Size imgSize, int stripRows, const cv::Mat1f dithMap, StripReader reader, StripWriter writer) {
+    return detail::streamStrips(imgSize, stripRows, reader, writer, [&](const cv::Mat1f strip, BitPlane& bits, int row) {
+        detail::ditherRows(strip, dithMap, bits, row);
+        return true;
+    });
+}
+
+// Streaming Halftone by Error Diffusion (Rolling Error Rows carry over between Strips)
+bool StreamErrDiff(cv::Size imgSize, int stripRows, std::string kernelName, bool serpentine, StripReader reader, StripWriter writer) {
+    std::vector<float> errBuf;
+    return detail::streamStrips(imgSize, stripRows, reader, writer, [&](const cv::Mat1f strip, BitPlane& bits, int row) {
+        return detail::diffuseStrip(kernelName, strip, bits, row, serpentine, errBuf);
+    });
+}
+
+// Out-of-core Tiled Direct Binary Search (DBS) Halftoning
+bool TiledDBS(cv::Size imgSize, int tileSize, StripReader reader, StripWriter writer, int kernelSize, float sigma, int iters, bool verbose) {
+    int height = imgSize.height, width = imgSize.width, halo = kernelSize + 1;  // Halo: c_pe is exact 1 Pixel around the Tile
+    if (tileSize <= 0 || width <= 0 || height <= 0) return false;
+    int tileRows = (height + tileSize - 1) / tileSize, tileCols = (width + tileSize - 1) / tileSize;
+    int workAmount = iters * tileRows * tileCols, workCount = 0;  // Recording Work Progress (by Tile)
+    size_t swapCount = 0, pixNum = (size_t)height * width;         // Recording Swap Rate
+
+    // 1. Map the Backing Files of the Gray Image & the Halftone
+    BackingMap grayMap("TiledDBS_gray", pixNum * sizeof(float)), resMap("TiledDBS_res", pixNum);
+    if (!grayMap.data || !resMap.data) return false;
+    cv::Mat1f grayImg(height, width, (float*)grayMap.data);
+    cv::Mat1b resImg(height, width, (uchar*)resMap.data);
+
+    // 2. Read the Gray Image Strip by Strip straight into its File, start from a random Halftone (Same Sequence as getRandBin)
+    for (int row = 0; row < height; row += tileSize) {
+        int rowEd = std::min(row + tileSize, height);
+        cv::Mat1f fileStrip = grayImg.rowRange(row, rowEd), strip = fileStrip;
+        if (!reader(row, strip) || strip.rows != fileStrip.rows || strip.cols != width) return false;
+        if (strip.data != fileStrip.data) strip.copyTo(fileStrip);  // The Reader replaced the Strip
+        for (int sRow = row; sRow < rowEd; sRow++)
+            for (int col = 0; col < width; col++) resImg(sRow, col) = rand() % 2 != 0;
+        grayMap.dropRows(width * sizeof(float), row, rowEd), resMap.dropRows(width, row, rowEd);
+    }
+
+    // 3. DBS Halftoning Passes, Tile by Tile
+    cv::Mat1f psfMat = detail::getGSF(kernelSize, sigma);  // Gaussian PSF Kernel
+    cv::Mat1f cppMat = detail::getCPP(psfMat);             // PSF Autocorrelation
+    cv::Size bufSize(std::min(tileSize + 2 * halo, width), std::min(tileSize + 2 * halo, height));
+    cv::Mat1f resBuf(bufSize), diffBuf(bufSize), lsErrBuf(bufSize), cpeBuf(bufSize);  // Window Buffers at the largest Window, reused by every Tile
+    for (int iter = 0; iter < iters; iter++) {
+        for (int tRow = 0; tRow < tileRows; tRow++) {
+            for (int tCol = 0; tCol < tileCols; tCol++) {
+                // 3-1. Copy out the Tile with its Halo, rebuild the Low-pass Error & c_pe from the current Bits
+                cv::Rect coreRect(tCol * tileSize, tRow * tileSize, std::min(tileSize, width - tCol * tileSize), std::min(tileSize, height - tRow * tileSize));
+                cv::Rect winRect = cv::Rect(coreRect.x - halo, coreRect.y - halo, coreRect.width + 2 * halo, coreRect.height + 2 * halo) & cv::Rect(0, 0, width, height);
+                cv::Rect bufRect(0, 0, winRect.width, winRect.height);
+                cv::Mat1f resWin = resBuf(bufRect), diffWin = diffBuf(bufRect), lsErrWin = lsErrBuf(bufRect), cpeWin = cpeBuf(bufRect);
+                resImg(winRect).convertTo(resWin, CV_32F);
+                cv::subtract(resWin, grayImg(winRect), diffWin);
+                filter::plConv(diffWin, psfMat, lsErrWin);  // Low-pass Error Image
+                detail::getCPE(lsErrWin, psfMat, cpeWin);   // PSF & Low-pass Error Cross-correlation
+
+                // 3-2. DBS over the Pixels of the Tile (Swaps may reach 1 Pixel into the Halo)
+                int rowSt = coreRect.y - winRect.y, colSt = coreRect.x - winRect.x;
+                for (int row = rowSt; row < rowSt + coreRect.height; row++)
+                    for (int col = colSt; col < colSt + coreRect.width; col++) {
+                        float minErr = 0;
+                        cv::Vec2i minPos = {-1, -1};
+                        std::tie(minErr, minPos) = detail::searchPix(resWin, lsErrWin, cpeWin, cppMat, {row, col}, kernelSize, psfMat);
+                        if (minPos[0] == -1 || minPos[1] == -1) continue;
+                        detail::applySwap(resWin, lsErrWin, cpeWin, cppMat, {row, col}, minPos, kernelSize, psfMat);
+                        swapCount++;
+                    }
+                cv::Mat1b resRoi = resImg(winRect);
+                resWin.convertTo(resRoi, CV_8U);  // Write back, the Halo carries the Swaps across the Seam
+
+                if (verbose) {  // Show Progress
+                    std::string title = "Tiled DBS Itr: " + std::to_string(iter + 1);
+                    std::string desc = "Swap Rate: " + std::to_string((int)((double)swapCount / (double)pixNum * 100)) + "%";
+                    saveData::showProgress(title, (float)++workCount / (float)workAmount, desc);
+                }
+            }
+            // 3-3. Rows above the Halo of the next Tile Row are done for this Pass
+            int doneRows = std::min(height, (tRow + 1) * tileSize - halo);
+            grayMap.dropRows(width * sizeof(float), 0, doneRows), resMap.dropRows(width, 0, doneRows);
+        }
+        swapCount = 0;  // Reset the Swap Rate
+    }
+
+    // 4. Pack & write the Halftone Strip by Strip
+    BitPlane stripBits;
+    for (int row = 0; row < height; row += tileSize) {
+        int rows = std::min(tileSize, height - row);
+        stripBits = BitPlane(rows, width);
+        for (int sRow = 0; sRow < rows; sRow++) {
+            const uchar* resRow = resImg.ptr<uchar>(row + sRow);
+            for (int col = 0; col < width; col++)
+                if (resRow[col]) stripBits.set(sRow, col, true);
+        }
+        if (!writer(row, stripBits)) return false;
+        resMap.dropRows(width, row, row + rows);
+    }
+    return true;
+}
+
+}  // namespace halftone
+
+namespace halftone::detail {  // Detail Functions
+
+// Streaming: Read, Halftone & Write Strip by Strip, reusing one Strip Buffer
+bool streamStrips(cv::Size imgSize, int stripRows, StripReader reader, StripWriter writer, std::function<bool(const cv::Mat1f, BitPlane&, int)> stripFunc) {
+    if (stripRows <= 0 || imgSize.width <= 0 || imgSize.height <= 0) return false;
+    cv::Mat1f stripBuf(std::min(stripRows, imgSize.height), imgSize.width);
+    BitPlane stripBits;
+
+    for (int row = 0; row < imgSize.height; row += stripRows) {
+        cv::Mat1f strip = stripBuf.rowRange(0, std::min(stripRows, imgSize.height - row));  // The last Strip may be shorter
+        int rows = strip.rows;
+        if (!reader(row, strip) || strip.rows != rows || strip.cols != imgSize.width) return false;
+        if (!stripFunc(strip, stripBits, row)) return false;
+        if (!writer(row, stripBits)) return false;
+    }
+    return true;
+}
+
+}  // namespace halftone::detail
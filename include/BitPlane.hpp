@@ -0,0 +1,81 @@
+#pragma once
+
+#ifndef BITPLANE_HPP
+#define BITPLANE_HPP
+
+#include <cstdint>
+#include <opencv2/opencv.hpp>
+#include <vector>
+
+namespace halftone {
+// Bit-packed Binary Image, 1 bit per Pixel (Bit col % 64 of Word col / 64, every Row starts at a new Word)
+class BitPlane {
+   private:
+    int height = 0, width = 0, words = 0;  // Image Size & 64-bit Words per Row
+    std::vector<uint64_t> bits;            // Packed Pixels
+
+   public:
+    // Constructor
+    BitPlane() = default;
+    BitPlane(int rows, int cols);              // All Pixels 0
+    explicit BitPlane(const cv::Mat1f binImg);  // Pack a Binary Image (> 0.5 is 1)
+    cv::Mat1f toMat() const;                    // Unpack to a Binary Image (Single Channel, 0-1, float)
+    // Size
+    int rows() const { return height; }
+    int cols() const { return width; }
+    bool empty() const { return bits.empty(); }
+    size_t bytes() const { return bits.size() * sizeof(uint64_t); }  // Memory of the Packed Pixels
+    // Pixel Access
+    bool get(int row, int col) const { return (bits[(size_t)row * words + (col >> 6)] >> (col & 63)) & 1; }
+    void set(int row, int col, bool val) {
+        uint64_t& word = bits[(size_t)row * words + (col >> 6)];
+        word = (word & ~(1ull << (col & 63))) | ((uint64_t)val << (col & 63));
+    }
+    void flip(int row, int col) { bits[(size_t)row * words + (col >> 6)] ^= 1ull << (col & 63); }
+    uint64_t* rowPtr(int row) { return bits.data() + (size_t)row * words; }              // Words of a Row
+    const uint64_t* rowPtr(int row) const { return bits.data() + (size_t)row * words; }  // Words of a Row
+    // Tone Statistics (Popcount)
+    size_t count() const;                  // Number of 1 Pixels
+    size_t count(cv::Rect roi) const;      // Number of 1 Pixels in a Region
+    double tone() const;                   // Ratio of 1 Pixels
+    cv::Mat1f toneMap(int blkSize) const;  // Ratio of 1 Pixels in every blkSize x blkSize Block
+};
+
+// Packed Panel Frame Buffer, 1, 2 or 4 bits per Pixel (Gray Level, 0 is Black), every Row starts at a new Byte
+// ... msbFirst: the first Pixel of a Byte sits in the high Bits (the usual Controller Order), else in the low Bits
+class FrameBuffer {
+   private:
+    int height = 0, width = 0, depth = 1, stride = 0;  // Image Size, Bits per Pixel & Bytes per Row
+    bool msbOrder = true;                              // Bit Order of the Pixels in a Byte
+    std::vector<uint8_t> bytes;                        // Packed Pixels
+
+   public:
+    // Constructor
+    FrameBuffer() = default;
+    FrameBuffer(int rows, int cols, int bpp, bool msbFirst = true);  // All Pixels 0
+    cv::Mat1f toMat() const;                                          // Unpack to a Gray Image (Level / Max Level, 0-1, float)
+    // Size & Layout
+    int rows() const { return height; }
+    int cols() const { return width; }
+    int bpp() const { return depth; }
+    int rowBytes() const { return stride; }
+    bool msbFirst() const { return msbOrder; }
+    bool empty() const { return bytes.empty(); }
+    size_t size() const { return bytes.size(); }  // Memory of the Packed Pixels
+    // Pixel Access
+    int shift(int col) const {  // Bit Position of a Pixel in its Byte
+        int slot = col % (8 / depth);
+        return msbOrder ? 8 - depth * (slot + 1) : depth * slot;
+    }
+    int get(int row, int col) const { return (bytes[(size_t)row * stride + col * depth / 8] >> shift(col)) & ((1 << depth) - 1); }
+    void set(int row, int col, int level) {
+        uint8_t& byte = bytes[(size_t)row * stride + col * depth / 8];
+        byte = (byte & ~(((1 << depth) - 1) << shift(col))) | (level << shift(col));
+    }
+    uint8_t* rowPtr(int row) { return bytes.data() + (size_t)row * stride; }              // Bytes of a Row
+    const uint8_t* rowPtr(int row) const { return bytes.data() + (size_t)row * stride; }  // Bytes of a Row
+};
+
+}  // namespace halftone
+
+#endif  // BITPLANE_HPP
@@ -3,6 +3,8 @@
 #ifndef FILTER_HPP
 #define FILTER_HPP
 
+#include <algorithm>
+#include <cstring>
 #include <opencv2/opencv.hpp>
 #include <vector>
 
@@ -15,8 +17,10 @@ namespace filter {
  * @param img Input Image (Single Channel)
  * @param kernel Kernel Matrix (Should be Parallel)
  * @return cv::Mat Convolved Image
+ * @note Kernels with a Footprint of at least fftMinArea go through fftConv
  */
 cv::Mat plConv(cv::Mat img, cv::Mat kernel);
+void plConv(const cv::Mat img, const cv::Mat kernel, cv::Mat& resImg);  // Into resImg (no Allocation once resImg has the Size)
 
 /**
  * @brief Do Convolution with the Image and Kernel
@@ -26,6 +30,32 @@ cv::Mat plConv(cv::Mat img, cv::Mat kernel);
  */
 cv::Mat conv(cv::Mat img, cv::Mat kernel);
 
+/**
+ * @brief Do Periodic Convolution with the Image and Kernel (Wrap around the Image Border)
+ * @param img Input Image (Single Channel)
+ * @param kernel Kernel Matrix
+ * @return cv::Mat Convolved Image
+ * @note Kernels with a Footprint of at least fftMinArea go through fftConv
+ */
+cv::Mat pdConv(cv::Mat img, cv::Mat kernel);
+void pdConv(const cv::Mat img, const cv::Mat kernel, cv::Mat& resImg);  // Into resImg (no Allocation once resImg has the Size)
+
+/**
+ * @brief Do Convolution with the Image and Kernel in the Frequency Domain (cv::dft)
+ * @param img Input Image (Single Channel)
+ * @param kernel Kernel Matrix
+ * @param periodic Wrap around the Image Border (true) or Pad with Zeros (false) (Default: false)
+ * @return cv::Mat Convolved Image (Same Result as pdConv / conv up to Float Rounding)
+ * @note The Kernel Spectrum is cached per Thread, so Repeated Calls with the same Kernel & Image Size only transform the Image
+ * @note The Output Overload keeps the padded Image, Spectrum & inverse Transform per Thread as well, so Repeated Calls
+ *       of one Size allocate no Mat (cv::dft may still use its own Scratch)
+ */
+cv::Mat fftConv(cv::Mat img, cv::Mat kernel, bool periodic = false);
+void fftConv(const cv::Mat img, const cv::Mat kernel, cv::Mat& resImg, bool periodic = false);
+
+// Kernel Footprint (rows * cols) from which plConv & pdConv switch to fftConv (Crossover measured by BenchFFT)
+extern int fftMinArea;
+
 /**
  * @brief Apply Local Edge Preserving Filter to the Image
  * @param img Input Image (Single Channel)
@@ -9,6 +9,7 @@
 #include <Eigen/Dense>
 #include <NumCpp.hpp>
 #include <algorithm>
+#include <atomic>
 #include <chrono>
 #include <cmath>
 #include <cstdint>
@@ -19,17 +20,22 @@
 #include <opencv2/opencv.hpp>
 #include <sstream>
 #include <string>
+#include <thread>
 #include <vector>
 
+#include "BitPlane.hpp"
 #include "ColorChecker.hpp"
 #include "ColorConvert.hpp"
 #include "ColorCorrect.hpp"
 #include "Filter.hpp"
 #include "Halftone.hpp"
 #include "Histogram.hpp"
+#include "MaskCache.hpp"
 #include "Measure.hpp"
 #include "PSO.hpp"
 #include "SaveData.hpp"
+#include "Sequence.hpp"
+#include "Stream.hpp"
 #include "WhiteBalance.hpp"
 
 #endif  // FUNCTIONS_HPP
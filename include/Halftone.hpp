@@ -21,6 +21,20 @@ const cv::Mat1b tMap8 = (cv::Mat1b(8, 8) << 0, 32, 8, 40, 2, 34, 10, 42, 48, 16,
 const cv::Mat1b kFloydSteinberg = (cv::Mat1b(3, 3) << 0, 0, 7, 3, 5, 1, 0, 0, 0);
 const cv::Mat1b kJJN = (cv::Mat1b(3, 5) << 0, 0, 0, 7, 5, 3, 5, 7, 5, 3, 1, 3, 5, 3, 1);
 
+// Palettes of Color ePaper Panels (BGR, 0-1)
+const std::vector<cv::Vec3f> pal6Color = {{0, 0, 0}, {1, 1, 1}, {0, 1, 1}, {0, 0, 1}, {1, 0, 0}, {0, 1, 0}};              // Black, White, Yellow, Red, Blue, Green
+const std::vector<cv::Vec3f> pal7Color = {{0, 0, 0}, {1, 1, 1}, {0, 1, 0}, {1, 0, 0}, {0, 0, 1}, {0, 1, 1}, {0, 0.5, 1}};  // + Orange
+
+// Halftoning Context of one Job: the PSF, its Tables & the Scratch Buffers (Nothing global, one Context per Thread)
+struct HalftoneContext {
+    int kSize = 3;               // Kernel Size of the PSF
+    float sigma = 1.0f;          // Sigma of the PSF
+    cv::Mat1f psfMat, cppMat;    // Gaussian PSF & its Autocorrelation c_pp
+    cv::Mat1f lsErrImg, cpeImg;  // Scratch: Low-pass Error & c_pe of the last DBS Job
+
+    HalftoneContext(int kernelSize = 3, float sigma = 1.0f);
+};
+
 /**
  * @brief Direct Binary Search (DBS) Halftoning
  * @param img Input image (Single Channel, 0-1, float)
@@ -35,6 +49,102 @@ const cv::Mat1b kJJN = (cv::Mat1b(3, 5) << 0, 0, 0, 7, 5, 3, 5, 7, 5, 3, 1, 3, 5
  */
 cv::Mat1f DBS(const cv::Mat1f img, cv::Mat1f initImg, int kernelSize = 3, float sigma = 1.0f, int iters = 10, bool verbose = false, std::string savePath = "");
 cv::Mat1f DBS(const cv::Mat1f grayImg, int kernelSize = 3, float sigma = 1.0f, int iters = 10, bool verbose = false, std::string savePath = "");
+// Explicit Context (PSF, Tables & Scratch of the Job), the above build a local one
+cv::Mat1f DBS(const cv::Mat1f grayImg, cv::Mat1f initImg, HalftoneContext& context, int iters = 10, bool verbose = false, std::string savePath = "");
+// Packed result, resBin is the initial image if it has the input size (otherwise random)
+void DBS(const cv::Mat1f grayImg, BitPlane& resBin, int kernelSize = 3, float sigma = 1.0f, int iters = 10, bool verbose = false, std::string savePath = "");
+
+/**
+ * @brief Active-set Direct Binary Search (A-DBS) Halftoning
+ * @param img Input image (Single Channel, 0-1, float)
+ * @param initImg Initial image for A-DBS (default: empty->random)
+ * @param kernelSize Kernel size for Point Spread Function (PSF) (default: 3)
+ * @param sigma Sigma value for Point Spread Function (PSF) (default: 1.0)
+ * @param maxIters Maximum number of iterations for A-DBS (default: 50)
+ * @param verbose Verbose mode (default: false)
+ * @return Halftoned image (Single Channel, 0-1, float)
+ *
+ * @note Each iteration only visits pixels within K of a swap/toggle in the previous one, stop when none is left.
+ */
+cv::Mat1f ADBS(const cv::Mat1f grayImg, cv::Mat1f initImg, int kernelSize = 3, float sigma = 1.0f, int maxIters = 50, bool verbose = false, std::string savePath = "");
+cv::Mat1f ADBS(const cv::Mat1f grayImg, int kernelSize = 3, float sigma = 1.0f, int maxIters = 50, bool verbose = false, std::string savePath = "");
+
+/**
+ * @brief Direct Binary Search (MR-DBS) Halftoning from an Error Diffusion Start
+ * @param img Input image (Single Channel, 0-1, float)
+ * @param kernelSize Kernel size for Point Spread Function (PSF) (default: 3)
+ * @param sigma Sigma value for Point Spread Function (PSF) (default: 1.0)
+ * @param iters Number of A-DBS iterations (default: 3)
+ * @param verbose Verbose mode (default: false)
+ * @return Halftoned image (Single Channel, 0-1, float)
+ *
+ * @note Starts from Floyd-Steinberg error diffusion and refines it by A-DBS, one pass reaches the error of a
+ *       10 iteration random-start DBS.
+ */
+cv::Mat1f MRDBS(const cv::Mat1f grayImg, int kernelSize = 3, float sigma = 1.0f, int iters = 3, bool verbose = false, std::string savePath = "");
+
+/**
+ * @brief Parallel Tiled Direct Binary Search (P-DBS) Halftoning
+ * @param img Input image (Single Channel, 0-1, float)
+ * @param initImg Initial image for P-DBS (default: empty->random)
+ * @param kernelSize Kernel size for Point Spread Function (PSF) (default: 3)
+ * @param sigma Sigma value for Point Spread Function (PSF) (default: 1.0)
+ * @param iters Number of iterations for P-DBS (default: 10)
+ * @param threads Number of threads (default: 0->OpenCV default)
+ * @param verbose Verbose mode (default: false)
+ * @return Halftoned image (Single Channel, 0-1, float)
+ *
+ * @note The image is split into (2K+2) x (2K+2) tiles, processed in 4 color phases with a barrier in between.
+ * @note Tiles of the same color never interact, so the result does not depend on the thread count.
+ * @note threads splits each phase into that many stripes of the OpenCV pool, the global thread number is left as is.
+ */
+cv::Mat1f PDBS(const cv::Mat1f grayImg, cv::Mat1f initImg, int kernelSize = 3, float sigma = 1.0f, int iters = 10, int threads = 0, bool verbose = false, std::string savePath = "");
+cv::Mat1f PDBS(const cv::Mat1f grayImg, int kernelSize = 3, float sigma = 1.0f, int iters = 10, int threads = 0, bool verbose = false, std::string savePath = "");
+
+// Result of Time-budgeted DBS
+struct TDBSResult {
+    cv::Mat1f resImg;  // Best halftone found within the budget (Single Channel, 0-1, float)
+    int iters = 0;     // Iterations done (an interrupted one counts)
+    float errVal = 0;  // Final mean squared low-pass error
+};
+
+/**
+ * @brief Time-budgeted Direct Binary Search (T-DBS) Halftoning
+ * @param img Input image (Single Channel, 0-1, float)
+ * @param deadlineMs Time budget in milliseconds (e.g. 150 for one panel refresh)
+ * @param targetErr Stop once the mean squared low-pass error reaches it (default: 0->no target)
+ * @param kernelSize Kernel size for Point Spread Function (PSF) (default: 3)
+ * @param sigma Sigma value for Point Spread Function (PSF) (default: 1.0)
+ * @param verbose Verbose mode (default: false)
+ * @return Halftoned image with the number of iterations & the final error
+ *
+ * @note Starts from Floyd-Steinberg error diffusion, every iteration visits the (2K+2) x (2K+2) tiles in the
+ *       order of their low-pass error energy, and the budget is checked after every tile.
+ * @note DBS only accepts error decreasing swaps, so the current halftone is always the best one so far.
+ */
+TDBSResult TDBS(const cv::Mat1f grayImg, float deadlineMs, float targetErr = 0.0f, int kernelSize = 3, float sigma = 1.0f, bool verbose = false, std::string savePath = "");
+
+/**
+ * @brief Color Direct Binary Search (C-DBS) Halftoning
+ * @param colorImg Input image (3 Channels BGR, 0-1, float)
+ * @param initImg Initial image for C-DBS (default: empty->random)
+ * @param kernelSize Kernel size for Point Spread Function (PSF) (default: 3)
+ * @param sigma Sigma value for Point Spread Function (PSF) (default: 1.0)
+ * @param iters Number of iterations for C-DBS (default: 10)
+ * @param perceptual Measure the error in the OKLab opponent space instead of per channel (default: false)
+ * @param verbose Verbose mode (default: false)
+ * @return Halftoned image (3 Channels BGR, 0-1, float)
+ *
+ * @note The result, low-pass error & c_pe images are pixel-interleaved, the 9 candidates of all 3 channels of a pixel are
+ *       evaluated in one walk of its 3x3 neighborhood, and the center toggles share one footprint update.
+ * @note Without perceptual, the channels do not interact and the result equals 3 single channel DBS runs.
+ *       With perceptual, the error is mapped by the OKLab Jacobian at neutral gray (sRGB -> XYZ -> LMS -> OKLab
+ *       matrices of colorconvert, up to scale), so a swap in one channel is weighed by its effect on all of L, a & b.
+ *       The channels of a pixel then pick their candidates together, the cross terms between them are added exactly and
+ *       only the best channel changes if they would cancel the gain. Pixels near the border search the channels in turn.
+ */
+cv::Mat3f CDBS(const cv::Mat3f colorImg, cv::Mat3f initImg, int kernelSize = 3, float sigma = 1.0f, int iters = 10, bool perceptual = false, bool verbose = false, std::string savePath = "");
+cv::Mat3f CDBS(const cv::Mat3f colorImg, int kernelSize = 3, float sigma = 1.0f, int iters = 10, bool perceptual = false, bool verbose = false, std::string savePath = "");
 
 /**
  * @brief Random Tiled Blocks Direct Binary Search (RTB-DBS) Halftoning
@@ -48,11 +158,44 @@ cv::Mat1f DBS(const cv::Mat1f grayImg, int kernelSize = 3, float sigma = 1.0f, i
  * @return Halftoned image (Single Channel, 0-1, float)
  *
  * @note If initImg is empty, random initialization is used.
+ * @note With blkSize instead of blkMap, the blkSize x blkSize block order comes from getVCMask (seed 0).
+ * @note Partial blocks at the bottom & right edge (image size not a multiple of the block size) are searched as well.
+ * @note blkSize must be 1-256 (getVCMask ranks are uint16), an empty blkMap or a blkSize out of range gives an empty image.
  */
 cv::Mat1f RTBDBS(const cv::Mat1f grayImg, cv::Mat1f initImg, cv::Mat1i blkMap, int kernelSize = 3, float sigma = 1.0f, int iters = 10, bool verbose = false, std::string savePath = "");
 cv::Mat1f RTBDBS(const cv::Mat1f grayImg, cv::Mat1i blkMap, int kernelSize = 3, float sigma = 1.0f, int iters = 10, bool verbose = false, std::string savePath = "");
 cv::Mat1f RTBDBS(const cv::Mat1f grayImg, cv::Mat1f initImg, int blkSize, int kernelSize = 3, float sigma = 1.0f, int iters = 10, bool verbose = false, std::string savePath = "");
 cv::Mat1f RTBDBS(const cv::Mat1f grayImg, int blkSize, int kernelSize = 3, float sigma = 1.0f, int iters = 10, bool verbose = false, std::string savePath = "");
+// Explicit Context (PSF, Tables & Scratch of the Job), the above build a local one
+cv::Mat1f RTBDBS(const cv::Mat1f grayImg, cv::Mat1f initImg, cv::Mat1i blkMap, HalftoneContext& context, int iters = 10, bool verbose = false, std::string savePath = "");
+// Packed result, resBin is the initial image if it has the input size (otherwise random), left as is if blkSize is out of range
+void RTBDBS(const cv::Mat1f grayImg, BitPlane& resBin, int blkSize, int kernelSize = 3, float sigma = 1.0f, int iters = 10, bool verbose = false, std::string savePath = "");
+
+/**
+ * @brief Parallel Random Tiled Blocks Direct Binary Search (PRTB-DBS) Halftoning
+ * @param img Input image (Single Channel, 0-1, float)
+ * @param initImg Initial image for PRTB-DBS (default: empty->random)
+ * @param blkMap Block map for PRTB-DBS (Single Channel, 0-blkSize[0]*blkSize[1]-1, int)
+ * @param kernelSize Kernel size for Point Spread Function (PSF) (default: 3)
+ * @param sigma Sigma value for Point Spread Function (PSF) (default: 1.0)
+ * @param iters Number of iterations for PRTB-DBS (default: 10)
+ * @param threads Number of threads (default: 0->OpenCV default)
+ * @param verbose Verbose mode (default: false)
+ * @return Halftoned image (Single Channel, 0-1, float)
+ *
+ * @note Rank by rank of the block map, the pixel of that rank is searched in every block at once, with a barrier
+ *       between the rank steps. Same rank pixels are a block apart; blocks smaller than 2K+2 are split into phases of
+ *       every n-th block, so pixels searched together never interact and the result does not depend on the thread count.
+ * @note The visiting order is rank-major over all blocks instead of block by block, so the result differs from
+ *       RTBDBS while keeping its randomized order. Partial blocks at the bottom & right edge are searched as well.
+ * @note With blkSize instead of blkMap, the blkSize x blkSize block order comes from getVCMask (seed 0).
+ * @note blkSize must be 1-256 (getVCMask ranks are uint16), an empty blkMap or a blkSize out of range gives an empty image.
+ * @note threads splits each phase into that many stripes of the OpenCV pool, the global thread number is left as is.
+ */
+cv::Mat1f PRTBDBS(const cv::Mat1f grayImg, cv::Mat1f initImg, cv::Mat1i blkMap, int kernelSize = 3, float sigma = 1.0f, int iters = 10, int threads = 0, bool verbose = false, std::string savePath = "");
+cv::Mat1f PRTBDBS(const cv::Mat1f grayImg, cv::Mat1i blkMap, int kernelSize = 3, float sigma = 1.0f, int iters = 10, int threads = 0, bool verbose = false, std::string savePath = "");
+cv::Mat1f PRTBDBS(const cv::Mat1f grayImg, cv::Mat1f initImg, int blkSize, int kernelSize = 3, float sigma = 1.0f, int iters = 10, int threads = 0, bool verbose = false, std::string savePath = "");
+cv::Mat1f PRTBDBS(const cv::Mat1f grayImg, int blkSize, int kernelSize = 3, float sigma = 1.0f, int iters = 10, int threads = 0, bool verbose = false, std::string savePath = "");
 
 /**
  * @brief Halftone by Dithering
@@ -62,6 +205,9 @@ cv::Mat1f RTBDBS(const cv::Mat1f grayImg, int blkSize, int kernelSize = 3, float
  * @return Halftoned image (Single Channel, 0-1, float)
  */
 cv::Mat1f Dither(const cv::Mat1f grayImg, int kernelSize = 2, bool verbose = false);
+void Dither(const cv::Mat1f grayImg, BitPlane& resBin, int kernelSize = 2);  // Packed result (left as is if not supported)
+void Dither(const cv::Mat1b grayImg, BitPlane& resBin, int kernelSize = 2);  // 8-bit input (0-255)
+void Dither(const cv::Mat1w grayImg, BitPlane& resBin, int kernelSize = 2);  // 16-bit input (0-65535)
 /**
  * @brief Halftone by Dithering
  * @param grayImg Input image (Single Channel, 0-1, float)
@@ -69,8 +215,13 @@ cv::Mat1f Dither(const cv::Mat1f grayImg, int kernelSize = 2, bool verbose = fal
  * @param verbose Verbose mode (default: false)
  * @return Halftoned image (Single Channel, 0-1, float)
  * @note It would dithering by thresholding with dithMap.
+ * @note 8-bit & 16-bit inputs are compared in their own domain: a pixel v is on if v > floor(threshold * 255 or 65535),
+ *       which is v / 255 > threshold for every integer v.
  */
 cv::Mat1f Dither(const cv::Mat1f grayImg, cv::Mat1f dithMap, bool verbose = false);
+void Dither(const cv::Mat1f grayImg, cv::Mat1f dithMap, BitPlane& resBin);  // Packed result
+void Dither(const cv::Mat1b grayImg, cv::Mat1f dithMap, BitPlane& resBin);  // 8-bit input (0-255)
+void Dither(const cv::Mat1w grayImg, cv::Mat1f dithMap, BitPlane& resBin);  // 16-bit input (0-65535)
 
 /**
  * @brief Halftone by Error Diffusion
@@ -80,6 +231,71 @@ cv::Mat1f Dither(const cv::Mat1f grayImg, cv::Mat1f dithMap, bool verbose = fals
  * @return Halftoned image (Single Channel, 0-1, float)
  */
 cv::Mat1f ErrDiff(const cv::Mat1f grayImg, int kernelSize = 3, bool verbose = false);
+void ErrDiff(const cv::Mat1f grayImg, BitPlane& resBin, int kernelSize = 3);  // Packed result (left as is if not supported)
+/**
+ * @brief Halftone by Error Diffusion
+ * @param grayImg Input image (Single Channel, 0-1, float)
+ * @param kernelName Error Diffusion Kernel ("FS", "JJN", "Stucki", "Sierra", "Burkes", "Atkinson")
+ * @param serpentine Scan odd rows from right to left with the mirrored kernel (default: false)
+ * @return Halftoned image (Single Channel, 0-1, float)
+ * @note Only the kernel rows of error are kept (O(width) memory), the taps of every kernel are unrolled at compile time.
+ */
+cv::Mat1f ErrDiff(const cv::Mat1f grayImg, std::string kernelName, bool serpentine = false);
+void ErrDiff(const cv::Mat1f grayImg, BitPlane& resBin, std::string kernelName, bool serpentine = false);  // Packed result (left as is if not supported)
+
+/**
+ * @brief Wavefront-parallel Error Diffusion
+ * @param grayImg Input image (Single Channel, 0-1, float)
+ * @param kernelSize Kernel size for Error Diffusion (3: Floyd-Steinberg, 5: JJN)
+ * @param threads Number of threads (default: 0->OpenCV default)
+ * @return Halftoned image (Single Channel, 0-1, float)
+ *
+ * @note Rows are dealt to the threads in turn, a row only works on a column once the row above has finished
+ *       2R + 1 columns further (R: Kernel reach to the right), so every error cell receives its contributions in
+ *       the serial order and the result is bit-identical to ErrDiff.
+ */
+cv::Mat1f PErrDiff(const cv::Mat1f grayImg, int kernelSize = 3, int threads = 0);
+void PErrDiff(const cv::Mat1f grayImg, BitPlane& resBin, int kernelSize = 3, int threads = 0);  // Packed result (left as is if not supported)
+
+/**
+ * @brief Multi-level Halftone by Dithering, straight into a packed frame buffer
+ * @param grayImg Input image (Single Channel, 0-1, float)
+ * @param frame Packed result (levels 2, 4, 16 -> 1, 2, 4 bpp, keeps its bit order, left as is if not supported)
+ * @param levels Number of gray levels (2, 4, 16)
+ * @param kernelSize Kernel size for Dithering (2, 4, 8)
+ * @note A pixel takes the level below its gray, or the one above if the fraction in between is above the threshold;
+ *       2 levels give the same pixels as the binary Dither.
+ */
+void Dither(const cv::Mat1f grayImg, FrameBuffer& frame, int levels, int kernelSize = 2);
+void Dither(const cv::Mat1f grayImg, cv::Mat1f dithMap, FrameBuffer& frame, int levels);  // Tiled dithering map (0-1, float)
+/**
+ * @brief Multi-level Halftone by Error Diffusion, straight into a packed frame buffer
+ * @param grayImg Input image (Single Channel, 0-1, float)
+ * @param frame Packed result (levels 2, 4, 16 -> 1, 2, 4 bpp, keeps its bit order, left as is if not supported)
+ * @param levels Number of gray levels (2, 4, 16)
+ * @param kernelName Error Diffusion Kernel (Names of ErrDiff, default: "FS")
+ * @param serpentine Scan odd rows from right to left with the mirrored kernel (default: false)
+ * @note Every pixel is quantized to the nearest level; 2 levels give the same pixels as the binary ErrDiff.
+ */
+void ErrDiff(const cv::Mat1f grayImg, FrameBuffer& frame, int levels, std::string kernelName = "FS", bool serpentine = false);
+
+/**
+ * @brief Palette Error Diffusion (Vector Error Diffusion for Multi-color Panels)
+ * @param colorImg Input image (BGR, 0-1, float)
+ * @param palette Colors of the panel (BGR, 0-1, at most 256, e.g. pal6Color, pal7Color)
+ * @param kernelSize Kernel size for Error Diffusion (3: kFloydSteinberg, 5: kJJN)
+ * @param perceptual Find the nearest color & diffuse the error in OKLab instead of BGR (default: false)
+ * @param gridSize Points per axis of the nearest color grid (default: 33)
+ * @return Palette index of every pixel (uint8), empty if not supported
+ *
+ * @note The nearest palette color of every point of a grid over the color box (BGR cube, or its OKLab bounds) is
+ *       found once, then every pixel costs one lookup of its closest grid point instead of a palette scan.
+ *       Colors closer than half a grid step to the border between two palette colors may take the other one.
+ * @note The nearest color & the error share one space, so the error stays bounded; the color plus the error is
+ *       clamped to the box before the lookup. The local mean is kept in the space of the diffusion.
+ */
+cv::Mat1b PaletteErrDiff(const cv::Mat3f colorImg, const std::vector<cv::Vec3f>& palette, int kernelSize = 3, bool perceptual = false, int gridSize = 33);
+cv::Mat3f applyPalette(const cv::Mat1b idxImg, const std::vector<cv::Vec3f>& palette);  // Colors of a Palette Index Image (BGR, 0-1)
 
 /**
  * @brief Void & Cluster Dither Array Generation
@@ -93,6 +309,7 @@ cv::Mat1f ErrDiff(const cv::Mat1f grayImg, int kernelSize = 3, bool verbose = fa
  * @return Dither array for Void & Cluster Dithering
  */
 cv::Mat1f VoidCluster(const cv::Mat1f binImg, int kernelSize = 3, float sigma = 1.0, bool normalize = false, bool verbose = false);
+cv::Mat1f VoidCluster(const cv::Mat1f binImg, const HalftoneContext& context, bool normalize = false, bool verbose = false);  // Explicit Context
 
 /**
  * @brief Generate Random Binary Image
@@ -100,21 +317,138 @@ cv::Mat1f VoidCluster(const cv::Mat1f binImg, int kernelSize = 3, float sigma =
  * @return Random binary image (Single Channel, 0-1, float)
  */
 cv::Mat1f getRandBin(cv::Vec2i imgSize);
+void getRandBin(BitPlane& randBin);  // Fill a packed image (Same random sequence as above)
 
 namespace detail {
-cv::Mat1f getGSF(int kSize, float sigma);
+cv::Mat1f getGSF(int kSize, float sigma);  // Gaussian PSF, a new Matrix per Call (No Cache, safe from any Thread)
+
+// Void & Cluster: Periodic Energy Map, updated by one PSF Footprint per Pixel Change,
+// with Tournament Trees for the tightest Cluster (1 with Max Energy) & the largest Void (0 with Min Energy)
+class VCEnergy {
+   private:
+    int height = 0, width = 0, leafNum = 0;  // Block Size & Leaves per Tree (Power of 2)
+    cv::Mat1f psfMat, enImg;                 // Gaussian PSF & Energy Map
+    cv::Mat1b binImg;                        // Current Pattern
+    std::vector<int> maxTree, minTree;       // Winner Pixel Index of every Node, -1 if None
+    std::vector<int> touchIdx;               // Scratch: Pixels to replay after a Toggle
 
-cv::Mat1f VCFilter(const cv::Mat1f blkImg, int kSize, float sigma);
+    int winner(int idxA, int idxB, bool isMax) const;  // Play one Match
+    void replay(int idx);                               // Update the Matches of a Pixel
 
-cv::Mat1i VCP1(const cv::Mat1f bkImg, int kSize, float sigma);
+   public:
+    VCEnergy() = default;
+    VCEnergy(const cv::Mat1f bkImg, const cv::Mat1f gskMat);
+    VCEnergy(cv::Size blkSize, const cv::Mat1f gskMat);  // Buffers only, reset before use
+    void reset(const cv::Mat1f bkImg);                   // Rebuild from a Pattern of the Block Size (No Allocation)
+    cv::Vec2i cluster() const { return {maxTree[1] / width, maxTree[1] % width}; }      // Tightest Cluster
+    cv::Vec2i largestVoid() const { return {minTree[1] / width, minTree[1] % width}; }  // Largest Void
+    void toggle(cv::Vec2i pos);                                                         // Add or Remove a Pixel
+};
 
-void VCP2(cv::Mat1f bkImg, cv::Mat1i rkImg, int kSize, float sigma);
+// Void & Cluster Phases: Rank the Cluster Part (1s), the Void Part (up to Half) & the rest, sharing one Energy Map
+void VCP1(const cv::Mat1f bkImg, cv::Mat1i rkImg, VCEnergy& vcEnergy);
+void VCP2(cv::Mat1f bkImg, cv::Mat1i rkImg, VCEnergy& vcEnergy);
+void VCP3(const cv::Mat1f bkImg, cv::Mat1i rkImg, VCEnergy& vcEnergy);
 
-void VCP3(const cv::Mat1f bkImg, cv::Mat1i rkImg, int kSize, float sigma);
+// Error Diffusion Kernels as Compile-time Tables (Current Pixel at Row 0, Center Column, Weights over sum)
+struct EDFloydSteinberg {
+    static constexpr int rows = 2, cols = 3, sum = 16;
+    static constexpr int wgt[rows][cols] = {{0, 0, 7}, {3, 5, 1}};
+};
+struct EDJJN {
+    static constexpr int rows = 3, cols = 5, sum = 48;
+    static constexpr int wgt[rows][cols] = {{0, 0, 0, 7, 5}, {3, 5, 7, 5, 3}, {1, 3, 5, 3, 1}};
+};
+struct EDStucki {
+    static constexpr int rows = 3, cols = 5, sum = 42;
+    static constexpr int wgt[rows][cols] = {{0, 0, 0, 8, 4}, {2, 4, 8, 4, 2}, {1, 2, 4, 2, 1}};
+};
+struct EDSierra {
+    static constexpr int rows = 3, cols = 5, sum = 32;
+    static constexpr int wgt[rows][cols] = {{0, 0, 0, 5, 3}, {2, 4, 5, 4, 2}, {0, 2, 3, 2, 0}};
+};
+struct EDBurkes {
+    static constexpr int rows = 2, cols = 5, sum = 32;
+    static constexpr int wgt[rows][cols] = {{0, 0, 0, 8, 4}, {2, 4, 8, 4, 2}};
+};
+struct EDAtkinson {  // Spreads 6/8 of the Error only
+    static constexpr int rows = 3, cols = 5, sum = 8;
+    static constexpr int wgt[rows][cols] = {{0, 0, 0, 1, 1}, {0, 1, 1, 1, 0}, {0, 0, 1, 0, 0}};
+};
+
+/**
+ * @brief Error Diffusion: Diffuse a Strip of Rows, keeping the Kernel Rows of Error in errBuf from one Strip to the next
+ * @param kernelName Error Diffusion Kernel (Names of ErrDiff)
+ * @param grayRows Input rows (Single Channel, 0-1, float)
+ * @param resRows Packed result of the rows
+ * @param rowOff Image row of the first strip row (Serpentine parity & rolling row index)
+ * @param serpentine Scan odd image rows from right to left
+ * @param errBuf Rolling error rows (empty before the first strip)
+ * @return false if the kernel is not supported
+ */
+bool diffuseStrip(std::string kernelName, const cv::Mat1f grayRows, BitPlane& resRows, int rowOff, bool serpentine, std::vector<float>& errBuf);
+
+// Error Diffusion: Multi-level into a packed Frame Buffer (Raster or Serpentine Scan), false if the Kernel is not supported
+bool diffuseLevels(std::string kernelName, const cv::Mat1f grayImg, FrameBuffer& frame, int levels, bool serpentine);
+
+// Error Diffusion: Wavefront-parallel diffuseStrip over the whole Image (Raster Scan), Bit-identical to it
+template <class Kernel>
+void wavefrontImg(const cv::Mat1f grayImg, BitPlane& resBin, int threads);
+
+// Palette: Nearest Palette Index of every Point of a gridSize^3 Grid over [boxMin, boxMax] (Index (c0 * gridSize + c1) * gridSize + c2)
+std::vector<uint8_t> paletteLUT(const std::vector<cv::Vec3f>& palVals, cv::Vec3f boxMin, cv::Vec3f boxMax, int gridSize);
+cv::Vec3f bgr2OKLab(cv::Vec3f bgrVal);        // Palette: BGR Color to OKLab (by colorconvert::XYZ2OKLAB)
+cv::Mat3f bgr2OKLab(const cv::Mat3f bgrImg);  // Palette: BGR Image to OKLab (Same Matrices, composed once)
+
+int levelBits(int levels);                                                                      // Multi-level: Bits per Pixel (1, 2, 4), 0 if not supported
+void ditherLevels(const cv::Mat1f grayImg, const cv::Mat1f thrTile, FrameBuffer& frame, int levels);  // Dithering: Multi-level into a packed Frame Buffer
+
+cv::Mat1f bayerTile(int kSize);                         // Dithering: Bayer Thresholds (0-1), empty if not supported
+cv::Mat ditherTile(const cv::Mat1f thrMap, int depth);  // Dithering: Thresholds in the Domain of a CV_8U, CV_16U or CV_32F input
+
+// Dithering: Set the Bit of every Pixel above the tiled Threshold (same Type as the Input),
+// every Tile Row is expanded to the Image Width once, 64 Pixels per Word by SIMD Compares, Rows in parallel
+void ditherRows(const cv::Mat grayImg, const cv::Mat thrTile, BitPlane& resBin, int rowOff = 0);  // rowOff: Image Row of the first Row
 
 float deltaLpErr(const cv::Mat1f lpErrImg, cv::Vec3i posCent, cv::Vec3i posSwap, int kSize, const cv::Mat1f gskMat);
 
-cv::Mat1f altLpErr(const cv::Mat1f lpErrImg, cv::Vec3i posPix, int kernelSize, const cv::Mat1f gskMat);
+cv::Mat1f getCPP(const cv::Mat1f gskMat);
+
+cv::Mat1f getCPE(const cv::Mat1f lpErrImg, const cv::Mat1f gskMat);
+void getCPE(const cv::Mat1f lpErrImg, const cv::Mat1f gskMat, cv::Mat1f& cpeImg);  // Into cpeImg (no Allocation once it has the Size)
+
+float deltaCpe(const cv::Mat1f cpeImg, const cv::Mat1f cppMat, cv::Vec3i posCent, cv::Vec3i posSwap);
+
+// Alter the Low-pass Error Image in-place, only the K x K footprint of posPix is touched
+void altLpErr(cv::Mat1f& lpErrImg, cv::Vec3i posPix, int kernelSize, const cv::Mat1f gskMat, float plnWgt = 1.0f);
+
+void altCpe(cv::Mat1f& cpeImg, const cv::Mat1f cppMat, cv::Vec3i posPix, int kSize, float plnWgt = 1.0f);
+
+std::pair<float, cv::Vec2i> searchPixInner(const cv::Mat1f resImg, const cv::Mat1f cpeImg, const cv::Mat1f cppMat, cv::Vec2i posPix);
+
+int minCandidate(const double* resNb, const double* cpeNb, const double* cppNb, double resCent, double cpeCent, double cppCent, float& minErr);
+
+std::pair<float, cv::Vec2i> searchPix(const cv::Mat1f resImg, const cv::Mat1f lpErrImg, const cv::Mat1f cpeImg, const cv::Mat1f cppMat, cv::Vec2i posPix, int kSize, const cv::Mat1f gskMat);
+
+void applySwap(cv::Mat1f& resImg, cv::Mat1f& lpErrImg, cv::Mat1f& cpeImg, const cv::Mat1f cppMat, cv::Vec2i posPix, cv::Vec2i posSwap, int kSize, const cv::Mat1f gskMat);
+
+cv::Mat1f getOppMat(bool perceptual);
+
+cv::Vec3i minCandidate(const double* resNb, const double* cpeNb, const double* cppNb, cv::Vec3d resCent, cv::Vec3d cpeCent, cv::Vec3d cppCent, cv::Vec3f& minErr);
+
+std::pair<float, cv::Vec3i> searchPixInner(const cv::Mat3f resImg, const cv::Mat3f cpeImg, const cv::Mat1f cppMat, cv::Vec2i posPix, const cv::Mat1f wgtMat);
+
+std::pair<float, cv::Vec3i> searchPix(const cv::Mat3f resImg, const cv::Mat3f lpErrImg, const cv::Mat3f cpeImg, const cv::Mat1f cppMat, cv::Vec2i posPix, int ch, int kSize, const cv::Mat1f gskMat, const cv::Mat1f oppMat);
+
+float deltaLpErr(const cv::Mat3f lpErrImg, cv::Vec3i posCent, cv::Vec3i posSwap, int kSize, const cv::Mat1f gskMat, cv::Vec3f oppVec);
+
+std::vector<cv::Mat3f> getChKers(const cv::Mat1f kerMat, const cv::Mat1f mixMat);
+
+void altPlanes(cv::Mat3f& plnImg, cv::Vec2i posPix, const std::vector<cv::Mat3f>& chKers, cv::Vec3f chTog, int margin);
+
+void applySwap(cv::Mat3f& resImg, cv::Mat3f& lpErrImg, cv::Mat3f& cpeImg, cv::Vec2i posPix, cv::Vec3i minIdx, const std::vector<cv::Mat3f>& lpKers, const std::vector<cv::Mat3f>& cpeKers);
+
+void markActive(cv::Mat1b& curActive, cv::Mat1b& nextActive, cv::Vec2i posPix, cv::Vec2i posVisit, int kSize);
 
 cv::Mat3f viewErr(cv::Mat1f errImg);
 
@@ -0,0 +1,31 @@
+#pragma once
+
+#ifndef MASKCACHE_HPP
+#define MASKCACHE_HPP
+
+#include <opencv2/opencv.hpp>
+#include <string>
+
+namespace halftone {
+
+extern std::string maskCacheDir;  // Folder of the cached Masks ("" keeps them in Memory only)
+
+/**
+ * @brief Void & Cluster Dither Array from the Mask Cache
+ * @param blkSize Size of the dither array (blkSize x blkSize, at most 256 for uint16 ranks)
+ * @param kernelSize Kernel size for Void & Cluster (default: 3)
+ * @param sigma Sigma value for Void & Cluster (default: 1.0)
+ * @param seed Seed of the random initial pattern (default: 0)
+ * @return Rank image (0 to blkSize^2-1, uint16), empty if blkSize is not supported
+ *
+ * @note Masks are kept as VC_<size>_K<kernel>_S<sigma>_R<seed>.u16 in maskCacheDir: a small header, then the ranks
+ *       in raster order. A hit maps the file read-only, a miss runs VoidCluster and writes the file through.
+ * @note The returned image is shared by all callers of the same key and must not be written to.
+ * @note Thread-safe: the first caller of a key makes the mask without holding the table lock, so other keys are
+ *       served meanwhile, and concurrent callers of the same key wait for that one result.
+ */
+cv::Mat1w getVCMask(int blkSize, int kernelSize = 3, float sigma = 1.0f, unsigned seed = 0);
+
+}  // namespace halftone
+
+#endif  // MASKCACHE_HPP
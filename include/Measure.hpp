@@ -24,4 +24,14 @@ double PSNR(const cv::Mat1f testImg, const cv::Mat1f refImg);
  */
 double SSIM(const cv::Mat1f testImg, const cv::Mat1f refImg, int kSize = 11, float sigma = 1.5, double cst1 = 6.5025, double cst2 = 58.5225);
 
+/**
+ * @brief Measure Perceived Error between a halftone and its reference image (the DBS objective per pixel)
+ * @param hfImg Halftone image (Single Channel, 0-1, float)
+ * @param refImg Reference image (Single Channel, 0-1, float)
+ * @param kSize Kernel Size of the Gaussian PSF (Default: 3)
+ * @param sigma Sigma Value of the Gaussian PSF (Default: 1.0)
+ * @return Mean squared low-pass error
+ */
+double HVSErr(const cv::Mat1f hfImg, const cv::Mat1f refImg, int kSize = 3, float sigma = 1.0);
+
 }  // namespace measure
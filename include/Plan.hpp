@@ -0,0 +1,69 @@
+#pragma once
+
+#ifndef PLAN_HPP
+#define PLAN_HPP
+
+#include <opencv2/opencv.hpp>
+#include <vector>
+
+#include "Halftone.hpp"
+
+namespace halftone {
+
+/**
+ * @brief Reusable Halftoning Plan for repeated Frames of one Size (like an FFTW Plan: build once, execute many times)
+ *
+ * @note The plan owns the PSF & c_pp (HalftoneContext), the RTB-DBS block sequence, the Void & Cluster energy map &
+ *       trees and every working buffer. execute writes into resImg and does not allocate on the heap once resImg
+ *       has the plan size (the first call may allocate it).
+ * @note The low-pass error, c_pe & energy map go through the same direct / FFT dispatch as DBS, RTBDBS & VoidCluster,
+ *       so the result equals them bit for bit at every kernel size. From filter::fftMinArea the FFT workspace is kept
+ *       per thread and reused, only cv::dft's own scratch may still allocate.
+ */
+class HalftonePlan {
+   public:
+    enum Algorithm { PlanDBS, PlanRTBDBS, PlanVoidCluster };
+
+   private:
+    Algorithm algo = PlanDBS;       // Algorithm of the Plan
+    cv::Size imgSize;               // Frame Size (Block Size for Void & Cluster)
+    int iters = 10;                 // DBS & RTB-DBS Iterations
+    HalftoneContext context;        // PSF, c_pp & the Low-pass Error / c_pe Scratch
+    cv::Mat1f diffImg;              // Scratch: Halftone - Gray before the Low-pass Filter
+    cv::Size blkDim;                // RTB-DBS: Block Size
+    std::vector<cv::Vec2i> blkSeq;  // RTB-DBS: Visiting Order inside a Block
+    cv::Mat1f bkImg;                // Void & Cluster: Working Pattern
+    cv::Mat1i rankImg;              // Void & Cluster: Ranks
+    detail::VCEnergy vcEnergy;      // Void & Cluster: Energy Map & Trees
+
+    void runDBS(const cv::Mat1f grayImg, cv::Mat1f& resImg);  // DBS or RTB-DBS Passes from the Start in resImg
+
+   public:
+    /**
+     * @param imgSize Size of every frame (Block size for Void & Cluster)
+     * @param algo Algorithm (PlanDBS, PlanRTBDBS, PlanVoidCluster)
+     * @param kernelSize Kernel size for Point Spread Function (PSF) (default: 3)
+     * @param sigma Sigma value for Point Spread Function (PSF) (default: 1.0)
+     * @param iters Number of iterations for DBS & RTB-DBS (default: 10)
+     * @param blkSize Block size of RTB-DBS (1-256), the block order comes from getVCMask (default: 32)
+     */
+    HalftonePlan(cv::Size imgSize, Algorithm algo, int kernelSize = 3, float sigma = 1.0f, int iters = 10, int blkSize = 32);
+
+    /**
+     * @brief Halftone a frame with the plan
+     * @param grayImg Input image of the plan size (Single Channel, 0-1, float), the initial pattern for Void & Cluster
+     * @param initImg Initial halftone of DBS & RTB-DBS (Same size, 0-1, float)
+     * @param resImg Halftoned image (Ranks 0-(size-1) for Void & Cluster), reused if it has the plan size
+     * @return false if a size does not fit the plan or the RTB-DBS block size is out of range
+     * @note Without initImg, DBS & RTB-DBS start from a random halftone (Same random sequence as getRandBin).
+     */
+    bool execute(const cv::Mat1f grayImg, const cv::Mat1f initImg, cv::Mat1f& resImg);
+    bool execute(const cv::Mat1f grayImg, cv::Mat1f& resImg);
+
+    cv::Size size() const { return imgSize; }
+    Algorithm algorithm() const { return algo; }
+};
+
+}  // namespace halftone
+
+#endif  // PLAN_HPP
@@ -0,0 +1,83 @@
+#pragma once
+
+#ifndef SEQUENCE_HPP
+#define SEQUENCE_HPP
+
+#include <opencv2/opencv.hpp>
+#include <vector>
+
+#include "BitPlane.hpp"
+
+namespace halftone {
+
+/**
+ * @brief Temporally coherent Direct Binary Search (DBS) Halftoning of Frame Sequences
+ *
+ * @note The halftone, the low-pass error & c_pe of the last frame are kept. A new frame only folds the pixels whose
+ *       gray value moved by more than threshold (against the value the state was built on) into the low-pass error &
+ *       c_pe by one PSF / c_pp footprint each, and A-DBS is run from the old halftone with only their neighborhoods
+ *       active. Unchanged regions keep their bits (no pattern flicker), and the search & the updates scale with the
+ *       changed area; only the comparison of the input is one pass over the frame.
+ * @note Smaller changes are not dropped: they add up against the kept value until they cross the threshold.
+ * @note The first frame (or a frame of another size) starts from a random halftone with all pixels active, i.e. ADBS.
+ */
+class SeqDBS {
+   private:
+    int kSize = 3, maxIters = 50;                // Kernel Size & A-DBS Iterations per Frame
+    float sigma = 1.0f, threshold = 0;           // PSF Sigma & Change Threshold
+    cv::Mat1f psfMat, cppMat;                    // Gaussian PSF & its Autocorrelation
+    cv::Mat1f refImg, resImg, lsErrImg, cpeImg;  // Gray Image the State is built on, Halftone, Low-pass Error & c_pe
+    cv::Mat1b curActive, nextActive;             // Active Pixels of this & next A-DBS Iteration
+    cv::Rect dirtyRect;                          // Bounding Box of the Pixels toggled by the last Frame
+    int changedCount = 0, visitCount = 0;        // Pixels over the Threshold & Searches of the last Frame
+
+    void reset(const cv::Mat1f grayImg);  // Random Halftone & full State for a new Size
+
+   public:
+    /**
+     * @param kernelSize Kernel size for Point Spread Function (PSF) (default: 3)
+     * @param sigma Sigma value for Point Spread Function (PSF) (default: 1.0)
+     * @param threshold Gray change (0-1) that re-halftones a pixel neighborhood (default: 1/64)
+     * @param maxIters Maximum number of A-DBS iterations per frame (default: 50)
+     */
+    SeqDBS(int kernelSize = 3, float sigma = 1.0f, float threshold = 1.0f / 64, int maxIters = 50);
+
+    /**
+     * @brief Halftone the next frame of the sequence
+     * @param grayImg Input image (Single Channel, 0-1, float)
+     * @return Bounding box of the pixels toggled against the last frame (empty if none), i.e. the partial refresh area
+     */
+    cv::Rect next(const cv::Mat1f grayImg);
+
+    cv::Mat1f result() const { return resImg; }   // Halftone of the last Frame (Shared with the State, do not write)
+    cv::Rect dirty() const { return dirtyRect; }  // Same as the Return Value of next
+    int changed() const { return changedCount; }  // Pixels over the Threshold in the last Frame
+    int visited() const { return visitCount; }    // Swap/Toggle Searches spent on the last Frame
+    void clear() { resImg = cv::Mat1f(); }        // Forget the State, the next Frame starts over
+};
+
+/**
+ * @brief Region of Interest Direct Binary Search (DBS) Halftoning for Partial Refresh
+ * @param grayImg New input image (Single Channel, 0-1, float)
+ * @param resBin Halftone of the previous frame (Same size, updated in place)
+ * @param dirtyRects Rectangles whose gray values changed
+ * @param kernelSize Kernel size for Point Spread Function (PSF) (default: 3)
+ * @param sigma Sigma value for Point Spread Function (PSF) (default: 1.0)
+ * @param maxIters Maximum number of A-DBS iterations per rectangle (default: 50)
+ * @return Bounding boxes of the pixels that differ from the previous frame (Overlapping ones merged)
+ *
+ * @note Every rectangle grows by kernelSize, i.e. by every pixel whose search reads a changed c_pe, and only this region
+ *       is searched by A-DBS from the previous bits. The low-pass error is built in a window with a halo of
+ *       kernelSize + 1 around it, so the error across the seam counts the fixed bits outside and the new pattern
+ *       blends into the old one. The cost follows the area of the rectangles, not of the frame.
+ */
+std::vector<cv::Rect> RegionDBS(const cv::Mat1f grayImg, BitPlane& resBin, const std::vector<cv::Rect>& dirtyRects, int kernelSize = 3, float sigma = 1.0f, int maxIters = 50);
+
+namespace detail {
+// DBS: A-DBS over the Active Pixels inside searchRect from the Box curRect, returns the Searches & grows dirtyRect by the Toggles
+int activeDBS(cv::Mat1f& resImg, cv::Mat1f& lpErrImg, cv::Mat1f& cpeImg, const cv::Mat1f cppMat, cv::Mat1b& curActive, cv::Mat1b& nextActive, cv::Rect curRect, cv::Rect searchRect, int kSize, const cv::Mat1f gskMat, int maxIters, cv::Rect& dirtyRect);
+}  // namespace detail
+
+}  // namespace halftone
+
+#endif  // SEQUENCE_HPP
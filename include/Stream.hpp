@@ -0,0 +1,86 @@
+#pragma once
+
+#ifndef STREAM_HPP
+#define STREAM_HPP
+
+#include <functional>
+#include <opencv2/opencv.hpp>
+#include <string>
+
+#include "BitPlane.hpp"
+
+namespace halftone {
+
+extern std::string tileWorkDir;  // Folder of the Backing Files of TiledDBS (unlinked while mapped)
+
+// Strip Reader: fill strip (Preallocated, the rows [row, row + strip.rows) of the image, Single Channel, 0-1, float), false to abort
+using StripReader = std::function<bool(int row, cv::Mat1f& strip)>;
+// Strip Writer: take the finished packed rows [row, row + bits.rows()), false to abort
+using StripWriter = std::function<bool(int row, const BitPlane& bits)>;
+
+/**
+ * @brief Streaming Halftone by Dithering (Bayer threshold map)
+ * @param imgSize Size of the whole image
+ * @param stripRows Rows per strip
+ * @param kernelSize Kernel size for Dithering (2, 4, 8)
+ * @param reader Strip reader
+ * @param writer Strip writer
+ * @return true if every strip was read, halftoned & written
+ * @note Memory is one float strip & one packed strip, independent of the image height.
+ */
+bool StreamDither(cv::Size imgSize, int stripRows, int kernelSize, StripReader reader, StripWriter writer);
+/**
+ * @brief Streaming Halftone by Dithering
+ * @param imgSize Size of the whole image
+ * @param stripRows Rows per strip
+ * @param dithMap Dithering map (Tiled over the image, 0-1, float)
+ * @param reader Strip reader
+ * @param writer Strip writer
+ * @return true if every strip was read, halftoned & written
+ */
+bool StreamDither(cv::Size imgSize, int stripRows, const cv::Mat1f dithMap, StripReader reader, StripWriter writer);
+
+/**
+ * @brief Streaming Halftone by Error Diffusion
+ * @param imgSize Size of the whole image
+ * @param stripRows Rows per strip
+ * @param kernelName Error Diffusion Kernel ("FS", "JJN", "Stucki", "Sierra", "Burkes", "Atkinson")
+ * @param serpentine Scan odd rows from right to left with the mirrored kernel
+ * @param reader Strip reader
+ * @param writer Strip writer
+ * @return true if every strip was read, halftoned & written
+ * @note The error rows of the kernel carry over from strip to strip, so the result equals ErrDiff on the whole image.
+ */
+bool StreamErrDiff(cv::Size imgSize, int stripRows, std::string kernelName, bool serpentine, StripReader reader, StripWriter writer);
+
+/**
+ * @brief Out-of-core Tiled Direct Binary Search (DBS) Halftoning
+ * @param imgSize Size of the whole image
+ * @param tileSize Size of the square tiles (also the rows per strip of reader & writer)
+ * @param reader Strip reader
+ * @param writer Strip writer
+ * @param kernelSize Kernel size for the Gaussian PSF (default: 3)
+ * @param sigma Sigma value for the Gaussian PSF (default: 1.0)
+ * @param iters Number of passes over all tiles (default: 10)
+ * @param verbose Show the progress (default: false)
+ * @return true if every strip was read & written and the backing files could be mapped
+ *
+ * @note The gray image (float) & the halftone (1 byte per pixel) live in memory-mapped backing files in tileWorkDir,
+ *       only the current tile with a halo of kernelSize + 1 pixels is copied out, optimized by DBS & written back.
+ *       Rows no tile of the pass needs anymore are released, so the resident memory follows the tile row; the random
+ *       start is written strip by strip while reading, and the window buffers are allocated once for the largest window.
+ * @note The low-pass error of a tile is rebuilt from the halo, i.e. from the latest bits of its neighbors, at every
+ *       visit, so the error across a seam is exact and swaps may cross it. Only the visiting order (tile by tile
+ *       instead of row by row) differs from DBS: the final low-pass error stays within 3% of DBS, and a tile
+ *       covering the whole image gives the result of DBS bit for bit (same random start).
+ */
+bool TiledDBS(cv::Size imgSize, int tileSize, StripReader reader, StripWriter writer, int kernelSize = 3, float sigma = 1.0f, int iters = 10, bool verbose = false);
+
+namespace detail {
+// Streaming: Read every Strip, halftone it with stripFunc (Strip, Packed Result, Image Row of the Strip) & write the Result
+bool streamStrips(cv::Size imgSize, int stripRows, StripReader reader, StripWriter writer, std::function<bool(const cv::Mat1f, BitPlane&, int)> stripFunc);
+}  // namespace detail
+
+}  // namespace halftone
+
+#endif  // STREAM_HPP
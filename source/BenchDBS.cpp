@@ -0,0 +1,171 @@
+#include "Functions.hpp"
+
+std::vector<int> benchKernels = {3, 5, 9, 13};
+std::vector<float> benchScales = {0.125, 0.25, 0.5};
+float benchSigma = 1.0;
+int benchIters = 2;
+std::vector<int> benchTiles = {32, 64, 128};
+std::vector<int> benchThreads = {1, 2, 4, 8, 16};
+
+int main(int argc, char** argv) {
+    // Setup the Save Path
+    std::string savePath = "res/bench/DBS";
+    if (system(("mkdir -p " + savePath).c_str()) != 0) return -1;
+    saveData::initVar(savePath, "BenchDBS");
+
+    // Read the Image (Same workload as DBS.cpp: Red Channel of Me.jpg)
+    cv::Mat img = cv::imread("data/Me.jpg");
+    img.convertTo(img, CV_32FC3, 1.0 / 255.0);
+    cv::Mat1f imgR = colorconvert::getCh(img, 2);
+
+    // Time per Iteration, normalized by Pixel Count (should follow K^2, not Image Area)
+    for (float scale : benchScales) {
+        cv::Mat1f benchImg;
+        cv::resize(imgR, benchImg, cv::Size(), scale, scale, cv::INTER_AREA);
+        for (int kSize : benchKernels) {
+            srand(0);
+            auto stTime = std::chrono::steady_clock::now();
+            halftone::DBS(benchImg, kSize, benchSigma, benchIters);
+            auto edTime = std::chrono::steady_clock::now();
+
+            double iterMs = std::chrono::duration<double, std::milli>(edTime - stTime).count() / benchIters;
+            double pixNs = iterMs * 1e6 / (double)(benchImg.rows * benchImg.cols);
+            std::string tag = std::to_string(benchImg.cols) + "x" + std::to_string(benchImg.rows) + "_K" + std::to_string(kSize);
+            std::cout << tag << ": " << iterMs << " ms/iter, " << pixNs << " ns/pixel" << std::endl;
+            saveData::logData(tag + " ms/iter", iterMs), saveData::logData(tag + " ns/pixel", pixNs);
+        }
+    }
+
+    // P-DBS Thread Scaling on the Largest Scale (Speedup against 1 Thread)
+    cv::Mat1f parImg;
+    cv::resize(imgR, parImg, cv::Size(), benchScales.back(), benchScales.back(), cv::INTER_AREA);
+    double baseMs = 0;
+    for (int threads : benchThreads) {
+        srand(0);
+        auto stTime = std::chrono::steady_clock::now();
+        halftone::PDBS(parImg, benchKernels.back(), benchSigma, benchIters, threads);
+        auto edTime = std::chrono::steady_clock::now();
+
+        double iterMs = std::chrono::duration<double, std::milli>(edTime - stTime).count() / benchIters;
+        baseMs = baseMs == 0 ? iterMs : baseMs;
+        std::string tag = "PDBS_K" + std::to_string(benchKernels.back()) + "_T" + std::to_string(threads);
+        std::cout << tag << ": " << iterMs << " ms/iter, x" << baseMs / iterMs << std::endl;
+        saveData::logData(tag + " ms/iter", iterMs), saveData::logData(tag + " speedup", baseMs / iterMs);
+    }
+
+    // Time to Target Error: Target is the Error of a 10 Iteration DBS from Random Start
+    int tgtKernel = benchKernels[2];
+    srand(0);
+    auto stTime = std::chrono::steady_clock::now();
+    cv::Mat1f dbsImg = halftone::DBS(parImg, tgtKernel, benchSigma, 10);
+    auto edTime = std::chrono::steady_clock::now();
+    double tgtErr = measure::HVSErr(dbsImg, parImg, tgtKernel, benchSigma);
+    double dbsMs = std::chrono::duration<double, std::milli>(edTime - stTime).count();
+    std::cout << "DBS_K" << tgtKernel << " (10 iters): error " << tgtErr << ", " << dbsMs << " ms" << std::endl;
+    saveData::logData("Target Error", tgtErr), saveData::logData("DBS time-to-target ms", dbsMs);
+
+    for (int iters = 1; iters <= 10; iters++) {
+        stTime = std::chrono::steady_clock::now();
+        cv::Mat1f mrImg = halftone::MRDBS(parImg, tgtKernel, benchSigma, iters);
+        edTime = std::chrono::steady_clock::now();
+        double mrErr = measure::HVSErr(mrImg, parImg, tgtKernel, benchSigma);
+        if (mrErr > tgtErr && iters < 10) continue;
+
+        double mrMs = std::chrono::duration<double, std::milli>(edTime - stTime).count();
+        std::cout << "MRDBS: error " << mrErr << " after " << iters << " full-res iters, " << mrMs << " ms" << std::endl;
+        saveData::logData("MRDBS time-to-target ms", mrMs), saveData::logData("MRDBS full-res iters", iters);
+        break;
+    }
+
+    // Color: 3 Sequential Channel Runs against one joint C-DBS Run (Same Random Start)
+    cv::Mat3f colImg;
+    cv::resize(img, colImg, cv::Size(), benchScales.back(), benchScales.back(), cv::INTER_AREA);
+    cv::Vec2i colSize = {colImg.rows, colImg.cols};
+    std::vector<cv::Mat> initChs = {halftone::getRandBin(colSize), halftone::getRandBin(colSize), halftone::getRandBin(colSize)};
+    std::vector<cv::Mat> colChs = colorconvert::splitCh(colImg);
+    stTime = std::chrono::steady_clock::now();
+    for (int ch = 0; ch < 3; ch++) halftone::DBS(colChs[ch], initChs[ch], tgtKernel, benchSigma, benchIters);
+    edTime = std::chrono::steady_clock::now();
+    double seqMs = std::chrono::duration<double, std::milli>(edTime - stTime).count();
+    std::cout << "DBS_K" << tgtKernel << " x3 channels: " << seqMs << " ms" << std::endl;
+    saveData::logData("Color sequential ms", seqMs);
+    for (bool perceptual : {false, true}) {
+        stTime = std::chrono::steady_clock::now();
+        halftone::CDBS(colImg, colorconvert::mergeCh(initChs), tgtKernel, benchSigma, benchIters, perceptual);
+        edTime = std::chrono::steady_clock::now();
+        double colMs = std::chrono::duration<double, std::milli>(edTime - stTime).count();
+        std::string tag = perceptual ? "CDBS_OKLab" : "CDBS_RGB";
+        std::cout << tag << ": " << colMs << " ms, x" << seqMs / colMs << std::endl;
+        saveData::logData(tag + " ms", colMs), saveData::logData(tag + " speedup", seqMs / colMs);
+    }
+
+    // Out-of-core Tiled DBS against in-memory DBS (Same Random Start & Iterations, Error Ratio should stay within 3%)
+    halftone::StripReader tileReader = [&](int row, cv::Mat1f& strip) {
+        parImg.rowRange(row, row + strip.rows).copyTo(strip);
+        return true;
+    };
+    for (int tileSize : benchTiles) {
+        cv::Mat1f tileImg(parImg.size(), 0.0f);
+        halftone::StripWriter tileWriter = [&](int row, const halftone::BitPlane& bits) {
+            bits.toMat().copyTo(tileImg.rowRange(row, row + bits.rows()));
+            return true;
+        };
+        srand(0);
+        stTime = std::chrono::steady_clock::now();
+        halftone::TiledDBS(parImg.size(), tileSize, tileReader, tileWriter, tgtKernel, benchSigma, 10);
+        edTime = std::chrono::steady_clock::now();
+        double tileErr = measure::HVSErr(tileImg, parImg, tgtKernel, benchSigma);
+        double tileMs = std::chrono::duration<double, std::milli>(edTime - stTime).count();
+        std::string tag = "TiledDBS_T" + std::to_string(tileSize);
+        std::cout << tag << ": error " << tileErr << " (x" << tileErr / tgtErr << " of DBS), " << tileMs << " ms" << std::endl;
+        saveData::logData(tag + " error ratio", tileErr / tgtErr), saveData::logData(tag + " ms", tileMs);
+    }
+
+    // Concurrent Jobs: one Context per Job, Kernel Sizes mixed (Throughput against 1 Thread, should be linear)
+    int jobNum = benchThreads.back();
+    std::vector<cv::Mat1f> jobInits(jobNum);
+    for (cv::Mat1f& jobInit : jobInits) jobInit = halftone::getRandBin(cv::Vec2i(parImg.rows, parImg.cols));
+    double jobBaseMs = 0;
+    for (int threads : benchThreads) {
+        std::atomic<int> nextJob(0);
+        std::vector<std::thread> workers;
+        stTime = std::chrono::steady_clock::now();
+        for (int idx = 0; idx < threads; idx++)
+            workers.emplace_back([&]() {
+                for (int job = nextJob++; job < jobNum; job = nextJob++) {
+                    halftone::HalftoneContext context(benchKernels[job % benchKernels.size()], benchSigma);
+                    halftone::DBS(parImg, jobInits[job], context, benchIters);
+                }
+            });
+        for (std::thread& worker : workers) worker.join();
+        edTime = std::chrono::steady_clock::now();
+
+        double jobMs = std::chrono::duration<double, std::milli>(edTime - stTime).count();
+        jobBaseMs = jobBaseMs == 0 ? jobMs : jobBaseMs;
+        std::string tag = "Jobs" + std::to_string(jobNum) + "_T" + std::to_string(threads);
+        std::cout << tag << ": " << jobMs << " ms, x" << jobBaseMs / jobMs << std::endl;
+        saveData::logData(tag + " ms", jobMs), saveData::logData(tag + " speedup", jobBaseMs / jobMs);
+    }
+
+    // PRTB-DBS Thread Scaling against serial RTB-DBS (Same Random Start & Block Order, Error Ratio should stay near 1)
+    cv::Mat1f rtbInit = halftone::getRandBin(cv::Vec2i(parImg.rows, parImg.cols));
+    stTime = std::chrono::steady_clock::now();
+    cv::Mat1f rtbImg = halftone::RTBDBS(parImg, rtbInit, benchTiles.front(), tgtKernel, benchSigma, benchIters);
+    edTime = std::chrono::steady_clock::now();
+    double rtbErr = measure::HVSErr(rtbImg, parImg, tgtKernel, benchSigma);
+    double rtbMs = std::chrono::duration<double, std::milli>(edTime - stTime).count() / benchIters;
+    std::cout << "RTBDBS_K" << tgtKernel << ": " << rtbMs << " ms/iter, error " << rtbErr << std::endl;
+    saveData::logData("RTBDBS ms/iter", rtbMs), saveData::logData("RTBDBS error", rtbErr);
+    for (int threads : benchThreads) {
+        stTime = std::chrono::steady_clock::now();
+        cv::Mat1f prtbImg = halftone::PRTBDBS(parImg, rtbInit, benchTiles.front(), tgtKernel, benchSigma, benchIters, threads);
+        edTime = std::chrono::steady_clock::now();
+
+        double prtbErr = measure::HVSErr(prtbImg, parImg, tgtKernel, benchSigma);
+        double iterMs = std::chrono::duration<double, std::milli>(edTime - stTime).count() / benchIters;
+        std::string tag = "PRTBDBS_K" + std::to_string(tgtKernel) + "_T" + std::to_string(threads);
+        std::cout << tag << ": " << iterMs << " ms/iter, x" << rtbMs / iterMs << ", error x" << prtbErr / rtbErr << std::endl;
+        saveData::logData(tag + " speedup", rtbMs / iterMs), saveData::logData(tag + " error ratio", prtbErr / rtbErr);
+    }
+    return 0;
+}
@@ -0,0 +1,51 @@
+#include "Functions.hpp"
+
+std::vector<std::string> benchKernels = {"FS", "JJN", "Stucki", "Sierra", "Burkes", "Atkinson"};
+std::vector<int> benchThreads = {1, 2, 4, 8};
+int benchRepeats = 5;
+
+int main(int argc, char** argv) {
+    // Setup the Save Path
+    std::string savePath = "res/bench/ED";
+    if (system(("mkdir -p " + savePath).c_str()) != 0) return -1;
+    saveData::initVar(savePath, "BenchED");
+
+    // Read the Image (Red Channel of Me.jpg)
+    cv::Mat img = cv::imread("data/Me.jpg");
+    img.convertTo(img, CV_32FC3, 1.0 / 255.0);
+    cv::Mat1f imgR = colorconvert::getCh(img, 2);
+    double pixNum = (double)imgR.rows * imgR.cols;
+    halftone::BitPlane resBin;
+
+    // Time per Pixel of every Kernel, Raster & Serpentine Scan
+    for (std::string kernel : benchKernels)
+        for (bool serpentine : {false, true}) {
+            auto stTime = std::chrono::steady_clock::now();
+            for (int idx = 0; idx < benchRepeats; idx++) halftone::ErrDiff(imgR, resBin, kernel, serpentine);
+            auto edTime = std::chrono::steady_clock::now();
+
+            double pixNs = std::chrono::duration<double, std::nano>(edTime - stTime).count() / benchRepeats / pixNum;
+            std::string tag = kernel + (serpentine ? "_Serpentine" : "_Raster");
+            std::cout << tag << ": " << pixNs << " ns/pixel" << std::endl;
+            saveData::logData(tag + " ns/pixel", pixNs);
+        }
+
+    // Wavefront-parallel Error Diffusion Thread Scaling (Speedup against the Serial Kernel)
+    for (int kSize : {3, 5}) {
+        auto stTime = std::chrono::steady_clock::now();
+        for (int idx = 0; idx < benchRepeats; idx++) halftone::ErrDiff(imgR, resBin, kSize);
+        auto edTime = std::chrono::steady_clock::now();
+        double baseMs = std::chrono::duration<double, std::milli>(edTime - stTime).count() / benchRepeats;
+        for (int threads : benchThreads) {
+            stTime = std::chrono::steady_clock::now();
+            for (int idx = 0; idx < benchRepeats; idx++) halftone::PErrDiff(imgR, resBin, kSize, threads);
+            edTime = std::chrono::steady_clock::now();
+
+            double parMs = std::chrono::duration<double, std::milli>(edTime - stTime).count() / benchRepeats;
+            std::string tag = "PErrDiff_K" + std::to_string(kSize) + "_T" + std::to_string(threads);
+            std::cout << tag << ": " << parMs << " ms, x" << baseMs / parMs << std::endl;
+            saveData::logData(tag + " ms", parMs), saveData::logData(tag + " speedup", baseMs / parMs);
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,49 @@
+#include "Functions.hpp"
+
+std::vector<int> benchSizes = {256, 512, 1024};
+std::vector<int> benchKernels = {3, 5, 7, 9, 11, 13, 15, 21, 31};
+int benchRepeats = 3;
+
+// Average Time (ms) of a Filter Call
+double timeConv(std::function<cv::Mat()> convFunc) {
+    auto stTime = std::chrono::steady_clock::now();
+    for (int idx = 0; idx < benchRepeats; idx++) convFunc();
+    auto edTime = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::milli>(edTime - stTime).count() / benchRepeats;
+}
+
+int main(int argc, char** argv) {
+    // Setup the Save Path
+    std::string savePath = "res/bench/FFT";
+    if (system(("mkdir -p " + savePath).c_str()) != 0) return -1;
+    saveData::initVar(savePath, "BenchFFT");
+
+    // Direct Loop against FFT for every Kernel Size (Periodic: V&C Filter, Zero-padded: DBS Initialization)
+    int autoArea = filter::fftMinArea;
+    for (int size : benchSizes) {
+        cv::Vec2i imgSize = {size, size};
+        cv::Mat1f benchImg = halftone::getRandBin(imgSize);
+        int perCross = 0, zeroCross = 0;  // Smallest Kernel where FFT wins
+        for (int kSize : benchKernels) {
+            cv::Mat1f psfMat = halftone::detail::getGSF(kSize, kSize / 6.0f).clone();
+            filter::fftMinArea = INT32_MAX;  // Force the Direct Loop
+            double perMs = timeConv([&]() { return filter::pdConv(benchImg, psfMat); });
+            double zeroMs = timeConv([&]() { return filter::plConv(benchImg, psfMat); });
+            double fftPerMs = timeConv([&]() { return filter::fftConv(benchImg, psfMat, true); });
+            double fftZeroMs = timeConv([&]() { return filter::fftConv(benchImg, psfMat, false); });
+            perCross = perCross == 0 && fftPerMs < perMs ? kSize : perCross;
+            zeroCross = zeroCross == 0 && fftZeroMs < zeroMs ? kSize : zeroCross;
+
+            std::string tag = std::to_string(size) + "_K" + std::to_string(kSize);
+            std::cout << tag << ": periodic " << perMs << " / " << fftPerMs << " ms, zero-padded " << zeroMs << " / " << fftZeroMs << " ms (direct / FFT)" << std::endl;
+            saveData::logData(tag + " periodic direct ms", perMs), saveData::logData(tag + " periodic FFT ms", fftPerMs);
+            saveData::logData(tag + " zero-padded direct ms", zeroMs), saveData::logData(tag + " zero-padded FFT ms", fftZeroMs);
+        }
+        std::cout << size << ": FFT wins from K" << perCross << " (periodic), K" << zeroCross << " (zero-padded)" << std::endl;
+        saveData::logData(std::to_string(size) + " periodic crossover K", perCross);
+        saveData::logData(std::to_string(size) + " zero-padded crossover K", zeroCross);
+    }
+    filter::fftMinArea = autoArea;
+    std::cout << "Automatic switch from footprint " << filter::fftMinArea << std::endl;
+    return 0;
+}
@@ -0,0 +1,38 @@
+#include "Functions.hpp"
+
+std::vector<int> benchLevels = {2, 4, 16};
+int benchRepeats = 5;
+
+int main(int argc, char** argv) {
+    // Setup the Save Path
+    std::string savePath = "res/bench/Levels";
+    if (system(("mkdir -p " + savePath).c_str()) != 0) return -1;
+    saveData::initVar(savePath, "BenchLevels");
+
+    // Read the Image (Red Channel of Me.jpg)
+    cv::Mat img = cv::imread("data/Me.jpg");
+    img.convertTo(img, CV_32FC3, 1.0 / 255.0);
+    cv::Mat1f imgR = colorconvert::getCh(img, 2);
+    double pixMega = (double)imgR.rows * imgR.cols / 1e6;
+
+    // Throughput of every Level Count, straight into the packed Frame Buffer
+    for (int levels : benchLevels) {
+        halftone::FrameBuffer frame(imgR.rows, imgR.cols, halftone::detail::levelBits(levels));
+
+        auto stTime = std::chrono::steady_clock::now();
+        for (int idx = 0; idx < benchRepeats; idx++) halftone::Dither(imgR, frame, levels, 8);
+        auto edTime = std::chrono::steady_clock::now();
+        double dithMps = pixMega * benchRepeats / std::chrono::duration<double>(edTime - stTime).count();
+
+        stTime = std::chrono::steady_clock::now();
+        for (int idx = 0; idx < benchRepeats; idx++) halftone::ErrDiff(imgR, frame, levels);
+        edTime = std::chrono::steady_clock::now();
+        double edMps = pixMega * benchRepeats / std::chrono::duration<double>(edTime - stTime).count();
+
+        std::string tag = "L" + std::to_string(levels);
+        std::cout << tag << ": Dither " << dithMps << " MP/s, ErrDiff " << edMps << " MP/s, " << frame.size() << " bytes" << std::endl;
+        saveData::logData(tag + "_Dither MP/s", dithMps), saveData::logData(tag + "_ErrDiff MP/s", edMps);
+        cv::imwrite(savePath + "/" + tag + "_ED.png", frame.toMat() * 255);
+    }
+    return 0;
+}
@@ -0,0 +1,68 @@
+#include "Functions.hpp"
+#include "Plan.hpp"
+
+float benchScale = 0.25;
+int benchKernel = 5;
+float benchSigma = 1.0;
+int benchIters = 2;
+int benchFrames = 5;
+
+// Heap Allocation Counter: glibc Allocator Entry Points, forwarded to the real ones (operator new ends up in malloc)
+std::atomic<long> allocCount(0);
+extern "C" void* __libc_malloc(size_t size);
+extern "C" void* __libc_calloc(size_t num, size_t size);
+extern "C" void* __libc_realloc(void* ptr, size_t size);
+extern "C" void* __libc_memalign(size_t align, size_t size);
+extern "C" void* malloc(size_t size) { return allocCount++, __libc_malloc(size); }
+extern "C" void* calloc(size_t num, size_t size) { return allocCount++, __libc_calloc(num, size); }
+extern "C" void* realloc(void* ptr, size_t size) { return allocCount++, __libc_realloc(ptr, size); }
+extern "C" int posix_memalign(void** ptr, size_t align, size_t size) {
+    allocCount++, *ptr = __libc_memalign(align, size);
+    return *ptr ? 0 : ENOMEM;
+}
+
+int main(int argc, char** argv) {
+    // Setup the Save Path
+    std::string savePath = "res/bench/Plan";
+    if (system(("mkdir -p " + savePath).c_str()) != 0) return -1;
+    saveData::initVar(savePath, "BenchPlan");
+
+    // Read the Image (Red Channel of Me.jpg)
+    cv::Mat img = cv::imread("data/Me.jpg");
+    img.convertTo(img, CV_32FC3, 1.0 / 255.0);
+    cv::Mat1f imgR = colorconvert::getCh(img, 2), benchImg;
+    cv::resize(imgR, benchImg, cv::Size(), benchScale, benchScale, cv::INTER_AREA);
+    cv::Mat1f vcPattern = halftone::getRandBin(cv::Vec2i(64, 64));
+
+    // Calls against Plans: Time & Heap Allocations per Frame, the Plans must not allocate once warmed up
+    std::vector<std::pair<std::string, halftone::HalftonePlan::Algorithm>> benchAlgos = {
+        {"DBS", halftone::HalftonePlan::PlanDBS}, {"RTBDBS", halftone::HalftonePlan::PlanRTBDBS}, {"VoidCluster", halftone::HalftonePlan::PlanVoidCluster}};
+    bool isClean = true;
+    for (auto [name, algo] : benchAlgos) {
+        bool isVC = algo == halftone::HalftonePlan::PlanVoidCluster;
+        cv::Mat1f inImg = isVC ? vcPattern : benchImg, resImg;
+        auto callFunc = [&]() {
+            if (algo == halftone::HalftonePlan::PlanDBS) resImg = halftone::DBS(inImg, benchKernel, benchSigma, benchIters);
+            if (algo == halftone::HalftonePlan::PlanRTBDBS) resImg = halftone::RTBDBS(inImg, 32, benchKernel, benchSigma, benchIters);
+            if (isVC) resImg = halftone::VoidCluster(inImg, benchKernel, benchSigma);
+        };
+        halftone::HalftonePlan plan(inImg.size(), algo, benchKernel, benchSigma, benchIters, 32);
+        plan.execute(inImg, resImg);  // Warm up: the first Call may allocate resImg
+
+        for (bool usePlan : {false, true}) {
+            long allocSt = allocCount;
+            auto stTime = std::chrono::steady_clock::now();
+            for (int frame = 0; frame < benchFrames; frame++) usePlan ? (void)plan.execute(inImg, resImg) : callFunc();
+            auto edTime = std::chrono::steady_clock::now();
+            double frameMs = std::chrono::duration<double, std::milli>(edTime - stTime).count() / benchFrames;
+            double frameAllocs = (double)(allocCount - allocSt) / benchFrames;
+
+            std::string tag = name + (usePlan ? "_Plan" : "_Call");
+            std::cout << tag << ": " << frameMs << " ms/frame, " << frameAllocs << " allocations/frame" << std::endl;
+            saveData::logData(tag + " ms/frame", frameMs), saveData::logData(tag + " allocations/frame", frameAllocs);
+            isClean = isClean && (!usePlan || frameAllocs == 0);
+        }
+    }
+    std::cout << (isClean ? "Plans run without Heap Allocations" : "Plans allocated in the steady State!") << std::endl;
+    return isClean ? 0 : 1;
+}
@@ -3,6 +3,7 @@
 int DBSKernelSize = 9;
 float DBSSigma = 1.0;
 int DBSIters = 10;
+bool DBSPerceptual = false;  // Measure the Error in OKLab instead of per Channel (Joint C-DBS)
 
 int main(int argc, char** argv) {
     // Load the Image
@@ -15,6 +16,14 @@ int main(int argc, char** argv) {
 
     // Create the Directory
     if (system(("mkdir -p " + savePath).c_str()) == -1) return -1;
+
+    // OKLab Error couples the Channels, so they are halftoned together
+    if (DBSPerceptual) {
+        saveData::initVar(savePath);
+        cv::Mat3f hfImg = halftone::CDBS(img, DBSKernelSize, DBSSigma, DBSIters, true, true);
+        saveData::imgMat(img, "HF_Input"), saveData::imgMat(hfImg, "HF_Result");
+        return 0;
+    }
     if (system(("mkdir -p " + savePath + "/Red").c_str()) == -1) return -1;
     if (system(("mkdir -p " + savePath + "/Green").c_str()) == -1) return -1;
     if (system(("mkdir -p " + savePath + "/Blue").c_str()) == -1) return -1;
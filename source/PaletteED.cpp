@@ -0,0 +1,32 @@
+#include "Functions.hpp"
+
+std::vector<std::pair<std::string, std::vector<cv::Vec3f>>> edPalettes = {{"6C", halftone::pal6Color}, {"7C", halftone::pal7Color}};
+std::vector<int> edKernels = {3, 5};
+
+int main(int argc, char** argv) {
+    // Load the Image
+    std::string savePath = "image/ME/PaletteED";
+    cv::Mat img = cv::imread("image/Me.jpg");
+    img.convertTo(img, CV_32FC3, 1.0 / 255.0);
+
+    // Create the Directory
+    if (system(("mkdir -p " + savePath).c_str()) == -1) return -1;
+    saveData::initVar(savePath, "PaletteED");
+    saveData::imgMat(img, "HF_Input");
+
+    // Every Palette, Kernel & Distance Space, Time per Pixel (LUT Build included)
+    for (auto& [palName, palette] : edPalettes)
+        for (int kSize : edKernels)
+            for (bool perceptual : {false, true}) {
+                auto stTime = std::chrono::steady_clock::now();
+                cv::Mat1b idxImg = halftone::PaletteErrDiff(img, palette, kSize, perceptual);
+                auto edTime = std::chrono::steady_clock::now();
+
+                double pixNs = std::chrono::duration<double, std::nano>(edTime - stTime).count() / (double)(img.rows * img.cols);
+                std::string tag = palName + "_K" + std::to_string(kSize) + (perceptual ? "_OKLab" : "_BGR");
+                std::cout << tag << ": " << pixNs << " ns/pixel" << std::endl;
+                saveData::logData(tag + " ns/pixel", pixNs);
+                saveData::imgMat(halftone::applyPalette(idxImg, palette), "HF_" + tag);
+            }
+    return 0;
+}
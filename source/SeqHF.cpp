@@ -0,0 +1,52 @@
+#include "Functions.hpp"
+
+int seqFrames = 30;
+int barSize = 48;                         // Moving Bar (like a Clock Hand) over a still Photo
+cv::Rect widgetRect = {32, 32, 160, 48};  // Widget redrawn by Partial Refresh
+
+int main(int argc, char** argv) {
+    // Setup the Save Path
+    std::string savePath = "res/sequence";
+    if (system(("mkdir -p " + savePath).c_str()) != 0) return -1;
+    saveData::initVar(savePath, "SeqHF");
+
+    // Read the Image (Red Channel of Me.jpg)
+    cv::Mat img = cv::imread("data/Me.jpg");
+    img.convertTo(img, CV_32FC3, 1.0 / 255.0);
+    cv::Mat1f imgR = colorconvert::getCh(img, 2);
+    double pixNum = (double)imgR.rows * imgR.cols;
+
+    // Halftone every Frame: the first one from Scratch, the others from the last Halftone
+    halftone::SeqDBS seqDBS;
+    for (int frame = 0; frame < seqFrames; frame++) {
+        cv::Mat1f grayImg = imgR.clone();
+        int barCol = frame * (imgR.cols - barSize) / (seqFrames - 1);
+        grayImg(cv::Rect(barCol, 0, barSize, imgR.rows / 4)).setTo(1.0f);
+
+        auto stTime = std::chrono::steady_clock::now();
+        cv::Rect dirtyRect = seqDBS.next(grayImg);
+        auto edTime = std::chrono::steady_clock::now();
+
+        double frameMs = std::chrono::duration<double, std::milli>(edTime - stTime).count();
+        std::string tag = "Frame " + std::to_string(frame);
+        std::cout << tag << ": " << frameMs << " ms, Changed " << seqDBS.changed() / pixNum * 100 << "%, Refresh " << dirtyRect.area() / pixNum * 100 << "%" << std::endl;
+        saveData::logData(tag + " ms", frameMs), saveData::logData(tag + " Refresh Area", (double)dirtyRect.area() / pixNum * 100);
+        cv::imwrite(savePath + "/Frame_" + std::to_string(frame) + ".png", seqDBS.result() * 255);
+    }
+
+    // Partial Refresh: redraw the Widget (a Checker Pattern) on the last Frame, only its Region is halftoned again
+    cv::Mat1f grayImg = imgR.clone();
+    for (int row = widgetRect.y; row < widgetRect.y + widgetRect.height; row++)
+        for (int col = widgetRect.x; col < widgetRect.x + widgetRect.width; col++) grayImg(row, col) = (row / 8 + col / 8) % 2 ? 0.9f : 0.1f;
+    halftone::BitPlane resBin(seqDBS.result());
+
+    auto stTime = std::chrono::steady_clock::now();
+    std::vector<cv::Rect> doneRects = halftone::RegionDBS(grayImg, resBin, {widgetRect});
+    auto edTime = std::chrono::steady_clock::now();
+
+    double regionMs = std::chrono::duration<double, std::milli>(edTime - stTime).count();
+    std::cout << "Widget: " << regionMs << " ms, " << doneRects.size() << " Refresh Rectangle(s)" << std::endl;
+    saveData::logData("Widget ms", regionMs);
+    cv::imwrite(savePath + "/Widget.png", resBin.toMat() * 255);
+    return 0;
+}
@@ -0,0 +1,47 @@
+#include "Functions.hpp"
+
+cv::Size posterSize = {24000, 16000};  // Poster Size (Width x Height), ~1.5 GB as a float Image
+int stripRows = 256;
+std::string edKernel = "Sierra";
+
+int main(int argc, char** argv) {
+    // Setup the Save Path
+    std::string savePath = "res/stream";
+    if (system(("mkdir -p " + savePath).c_str()) != 0) return -1;
+
+    // Reader: Generate the Strips of a Radial Gradient instead of holding the whole Image
+    halftone::StripReader reader = [](int row, cv::Mat1f& strip) {
+        float centR = posterSize.height / 2.0f, centC = posterSize.width / 2.0f, maxDist = std::hypot(centR, centC);
+        for (int sRow = 0; sRow < strip.rows; sRow++)
+            for (int col = 0; col < strip.cols; col++) strip(sRow, col) = std::hypot(row + sRow - centR, col - centC) / maxDist;
+        return true;
+    };
+
+    // Threshold Map: 64 x 64 Void & Cluster Ranks from the Mask Cache
+    cv::Mat1f dithMap;
+    halftone::getVCMask(64).convertTo(dithMap, CV_32F, 1.0 / (64 * 64));
+
+    // Writer: Append the finished Rows to a binary PBM (P4: MSB first, 1 is Black)
+    for (bool useED : {false, true}) {
+        std::string fileName = savePath + (useED ? "/Poster_ED.pbm" : "/Poster_Dither.pbm");
+        std::ofstream pbmFile(fileName, std::ios::binary);
+        pbmFile << "P4\n" << posterSize.width << " " << posterSize.height << "\n";
+        std::vector<uint8_t> rowBytes((posterSize.width + 7) / 8);
+        halftone::StripWriter writer = [&](int row, const halftone::BitPlane& bits) {
+            for (int sRow = 0; sRow < bits.rows(); sRow++) {
+                std::fill(rowBytes.begin(), rowBytes.end(), 0);
+                for (int col = 0; col < bits.cols(); col++)
+                    if (!bits.get(sRow, col)) rowBytes[col >> 3] |= 0x80 >> (col & 7);
+                pbmFile.write((const char*)rowBytes.data(), rowBytes.size());
+            }
+            return (bool)pbmFile;
+        };
+
+        auto stTime = std::chrono::steady_clock::now();
+        bool isDone = useED ? halftone::StreamErrDiff(posterSize, stripRows, edKernel, true, reader, writer)
+                            : halftone::StreamDither(posterSize, stripRows, dithMap, reader, writer);
+        auto edTime = std::chrono::steady_clock::now();
+        std::cout << fileName << (isDone ? " done in " : " failed after ") << std::chrono::duration<double>(edTime - stTime).count() << " s" << std::endl;
+    }
+    return 0;
+}
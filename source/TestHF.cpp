@@ -104,7 +104,7 @@ int main(int argc, char** argv) {
 
     // Test 5: Random Tiled Blocks Direct Binary Search (RTB-DBS)
     std::cout << "Test 5: Random Tiled Blocks Direct Binary Search (RTB-DBS)" << std::endl;
-    dithMap = halftone::VoidCluster(halftone::getRandBin(cv::Vec2i(8, 8)), 3, 1.0f, false);
+    halftone::getVCMask(8, 3, 1.0f).convertTo(dithMap, CV_32F);
     std::function tfRTBDBSK3 = [](cv::Mat1f img) { return halftone::RTBDBS(img, cv::Mat1f::zeros(img.size()), dithMap, 3, 1.0, 10, true); };
     std::function tfRTBDBSK5 = [](cv::Mat1f img) { return halftone::RTBDBS(img, cv::Mat1f::zeros(img.size()), dithMap, 5, 1.0, 10, true); };
     std::function tfRTBDBSK13 = [](cv::Mat1f img) { return halftone::RTBDBS(img, cv::Mat1f::zeros(img.size()), dithMap, 13, 1.0, 10, true); };
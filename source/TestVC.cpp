@@ -2,16 +2,19 @@
 
 int main() {
     saveData::initVar("res/test/VoidCluster");
-    // Generate Random Image (16x16) (32x32) (64x64) (128x128)
+    // Generate Random Image (16x16) (32x32) (64x64) (128x128) (256x256) (512x512)
     std::vector<cv::Mat1f> imgList;
-    for (int idx = 4; idx <= 7; idx++) {
+    for (int idx = 4; idx <= 9; idx++) {
         cv::Mat1f img = halftone::getRandBin(cv::Vec2i(1 << idx, 1 << idx));
         imgList.push_back(img);
         saveData::imgMat(img, "Rand_" + std::to_string(1 << idx));
     }
     // Do Void Cluster Algorithm
     for (int idx = 0; idx < imgList.size(); idx++) {
+        auto stTime = std::chrono::steady_clock::now();
         cv::Mat1f img = halftone::VoidCluster(imgList[idx], 3, 1.0, true);
+        auto edTime = std::chrono::steady_clock::now();
+        std::cout << "VC_" << (1 << (idx + 4)) << ": " << std::chrono::duration<double>(edTime - stTime).count() << " s" << std::endl;
         saveData::imgMat(img, "VC_" + std::to_string(1 << (idx + 4)));
     }
     return 0;